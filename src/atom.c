@@ -0,0 +1,425 @@
+/* $Id$ */
+/*
+ * Copyright (c) 2024 Michael Graves
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * attribute names and class words are interned once after parsing.  Each
+ * distinct string becomes an atom, a small integer, so the matcher finds
+ * an attribute by comparing integers and ".a.b" is a couple of searches
+ * in the sorted atoms of the element's classes.  Like the rest of hq
+ * atoms compare without regard to case.
+ */
+
+#include "config.h"
+
+#if HAVE_SYS_QUEUE
+#include <sys/queue.h>
+#endif
+
+#include <ctype.h>
+#if HAVE_ERR
+#include <err.h>
+#endif
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "hq.h"
+
+#define IS_WORDSEP(_c) \
+		((_c) == ' ' || (_c) == '\t' || (_c) == '\n' || (_c) == '\r' || \
+		 (_c) == '\f')
+
+static uint32_t atom_find(struct domhead *, const char *, size_t, uint32_t);
+static uint32_t atom_add(struct domhead *, const char *, size_t);
+static void atom_rehash(struct domhead *);
+static int atom_cmp(const void *, const void *);
+static void class_set(struct domhead *, struct dom_elem *, struct attr_elem *);
+static int attr_cmp(const void *, const void *);
+static void attr_index(struct domhead *, struct dom_elem *);
+static void type_ordinals(struct domhead *);
+
+/* FNV-1a of the lower cased word */
+uint32_t
+atom_hash(const char *s, size_t len)
+{
+	uint32_t h = 2166136261U;
+
+	while (len-- > 0) {
+		h ^= (unsigned char)tolower((unsigned char)*s++);
+		h *= 16777619U;
+	}
+	return(h);
+}
+
+/* returns the slot holding the word or the empty slot it would go in */
+static uint32_t
+atom_find(struct domhead *dh, const char *s, size_t len, uint32_t h)
+{
+	struct atom *a;
+	uint32_t i, mask = dh->nslots - 1;
+
+	for (i = h & mask; dh->aslots[i] != 0; i = (i + 1) & mask) {
+		a = &dh->atoms[dh->aslots[i] - 1];
+		if (a->hash == h && a->len == len &&
+		    strncasecmp(a->str, s, len) == 0)
+			break;
+	}
+	return(i);
+}
+
+static void
+atom_rehash(struct domhead *dh)
+{
+	uint32_t i, n;
+
+	n = dh->nslots ? dh->nslots * 2 : 256;
+	free(dh->aslots);
+	if ((dh->aslots = calloc(n, sizeof(uint32_t))) == NULL)
+		err(1, "calloc");
+	alloc_bytes += n * sizeof(uint32_t);
+	dh->nslots = n;
+	for (i = 0; i < dh->natoms; i++)
+		dh->aslots[atom_find(dh, dh->atoms[i].str, dh->atoms[i].len,
+		    dh->atoms[i].hash)] = i + 1;
+}
+
+/* intern the word, the string must live as long as the dom */
+static uint32_t
+atom_add(struct domhead *dh, const char *s, size_t len)
+{
+	struct atom *a;
+	uint32_t h, i, n;
+
+	if (dh->natoms * 2 >= dh->nslots)
+		atom_rehash(dh);
+	h = atom_hash(s, len);
+	i = atom_find(dh, s, len, h);
+	if (dh->aslots[i] != 0)
+		return(dh->aslots[i] - 1);
+	if (dh->natoms == dh->atomsz) {
+		n = dh->atomsz ? dh->atomsz * 2 : 64;
+		if ((a = reallocarray(dh->atoms, n, sizeof(*a))) == NULL)
+			err(1, "reallocarray");
+		alloc_bytes += (n - dh->atomsz) * sizeof(*a);
+		dh->atoms = a;
+		dh->atomsz = n;
+	}
+	a = &dh->atoms[dh->natoms];
+	a->str = s;
+	a->len = len;
+	a->hash = h;
+	dh->aslots[i] = dh->natoms + 1;
+	return(dh->natoms++);
+}
+
+/* the atom of a string or ATOM_NONE if the document does not have it */
+uint32_t
+find_atom(struct domhead *dh, const char *s)
+{
+	size_t len = strlen(s);
+	uint32_t i;
+
+	if (dh->nslots == 0)
+		return(ATOM_NONE);
+	i = atom_find(dh, s, len, atom_hash(s, len));
+	if (dh->aslots[i] == 0)
+		return(ATOM_NONE);
+	return(dh->aslots[i] - 1);
+}
+
+static int
+atom_cmp(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+
+	return((x > y) - (x < y));
+}
+
+/* split the class attribute into its sorted, unique atoms */
+static void
+class_set(struct domhead *dh, struct dom_elem *e, struct attr_elem *a)
+{
+	struct elem_info *x = DOM_INFO(dh, e);
+	const char *v, *p, *end;
+	uint32_t j, k, *c;
+	size_t len, n;
+
+	if ((v = attr_value(dh, a, &len)) == NULL)
+		return;
+	x->cls = dh->ncls;
+	for (p = v, end = v + len; p < end; p += n) {
+		while (p < end && IS_WORDSEP(*p))
+			p++;
+		for (n = 0; p + n < end && !IS_WORDSEP(p[n]); n++)
+			;
+		if (n == 0)
+			continue;
+		if (dh->ncls == dh->clssz) {
+			k = dh->clssz ? dh->clssz * 2 : 256;
+			if ((c = reallocarray(dh->cls, k, sizeof(*c))) == NULL)
+				err(1, "reallocarray");
+			alloc_bytes += (k - dh->clssz) * sizeof(*c);
+			dh->cls = c;
+			dh->clssz = k;
+		}
+		dh->cls[dh->ncls++] = atom_add(dh, p, n);
+	}
+	/* sort and drop repeats */
+	c = &dh->cls[x->cls];
+	n = dh->ncls - x->cls;
+	qsort(c, n, sizeof(*c), atom_cmp);
+	for (j = k = 0; j < n; j++) {
+		if (k == 0 || c[j] != c[k - 1])
+			c[k++] = c[j];
+	}
+	x->ncls = k;
+	dh->ncls = x->cls + k;
+}
+
+static struct domhead *sort_dh;
+
+static int
+attr_cmp(const void *a, const void *b)
+{
+	uint32_t x = sort_dh->attrs[*(const uint32_t *)a].katom;
+	uint32_t y = sort_dh->attrs[*(const uint32_t *)b].katom;
+
+	if (x != y)
+		return((x > y) - (x < y));
+	/* the first of a repeated attribute wins */
+	x = *(const uint32_t *)a;
+	y = *(const uint32_t *)b;
+	return((x > y) - (x < y));
+}
+
+/* wide elements get their attributes sorted by name atom */
+static void
+attr_index(struct domhead *dh, struct dom_elem *e)
+{
+	uint32_t i, k, *c;
+
+	if (dh->naidx + e->nattr > dh->aidxsz) {
+		k = dh->aidxsz ? dh->aidxsz * 2 : 256;
+		while (k < dh->naidx + e->nattr)
+			k *= 2;
+		if ((c = reallocarray(dh->aidx, k, sizeof(*c))) == NULL)
+			err(1, "reallocarray");
+		alloc_bytes += (k - dh->aidxsz) * sizeof(*c);
+		dh->aidx = c;
+		dh->aidxsz = k;
+	}
+	DOM_INFO(dh, e)->aidx = dh->naidx;
+	c = &dh->aidx[dh->naidx];
+	for (i = 0; i < e->nattr; i++)
+		c[i] = e->attr + i;
+	sort_dh = dh;
+	qsort(c, e->nattr, sizeof(*c), attr_cmp);
+	dh->naidx += e->nattr;
+}
+
+/*
+ * number every element among the siblings of its name for :nth-of-type()
+ * and friends, with a counter per name atom over the children of each
+ * node.  The counters are cleared on the last sibling of each name so
+ * the pass is linear.
+ */
+static void
+type_ordinals(struct domhead *dh)
+{
+	struct dom_elem *p, *e;
+	struct elem_info *x;
+	uint32_t i, j, n, *cnt;
+
+	/* the atom of the name waits in ntype until the counts are known */
+	for (i = 1; i < dh->nelems; i++) {
+		e = DOM_NODE(dh, i);
+		if (e->type == DOMF_ELEM)
+			DOM_INFO(dh, e)->ntype = atom_add(dh, DOM_STR(dh, e->name),
+			    e->name.len);
+	}
+	if ((cnt = calloc(dh->natoms + 1, sizeof(*cnt))) == NULL)
+		err(1, "calloc");
+	for (i = 0; i < dh->nelems; i++) {
+		p = DOM_NODE(dh, i);
+		if (p->child == 0)
+			continue;
+		for (j = p->child; j != 0; j = e->next) {
+			e = DOM_NODE(dh, j);
+			if (e->type != DOMF_ELEM)
+				continue;
+			x = DOM_INFO(dh, e);
+			x->tpos = ++cnt[x->ntype];
+			DOM_INFO(dh, p)->nel++;
+		}
+		for (j = p->child; j != 0; j = e->next) {
+			e = DOM_NODE(dh, j);
+			if (e->type != DOMF_ELEM)
+				continue;
+			x = DOM_INFO(dh, e);
+			n = cnt[x->ntype];
+			if (x->tpos == n)
+				cnt[x->ntype] = 0;
+			x->ntype = n;
+		}
+	}
+	free(cnt);
+}
+
+/*
+ * intern every attribute name, split the class attributes, index the
+ * wide elements and number the elements by name.  Run once the dom is
+ * complete, the decoded values are cached by attribute.
+ */
+void
+dom_atoms(struct domhead *dh)
+{
+	struct dom_elem *e;
+	struct attr_elem *a, *ca;
+	uint32_t i;
+
+	for (i = 0; i < dh->nattrs; i++) {
+		a = &dh->attrs[i];
+		a->katom = atom_add(dh, DOM_STR(dh, a->key), a->key.len);
+	}
+	dh->class_atom = find_atom(dh, "class");
+	type_ordinals(dh);
+	for (i = 1; i < dh->nelems; i++) {
+		e = DOM_NODE(dh, i);
+		if (e->type != DOMF_ELEM || e->nattr == 0)
+			continue;
+		if (e->nattr > ATTR_WIDE)
+			attr_index(dh, e);
+		if (dh->class_atom != ATOM_NONE &&
+		    (ca = elem_attr(dh, e, dh->class_atom)) != NULL)
+			class_set(dh, e, ca);
+	}
+}
+
+/* the attribute of e named by the atom or NULL */
+struct attr_elem *
+elem_attr(struct domhead *dh, struct dom_elem *e, uint32_t atom)
+{
+	struct attr_elem *a;
+	const uint32_t *c;
+	uint32_t lo, hi, mid;
+
+	if (e->nattr <= ATTR_WIDE) {
+		DOM_FOREACH_ATTR(a, dh, e) {
+			if (a->katom == atom)
+				return(a);
+		}
+		return(NULL);
+	}
+	/* leftmost of the run of equal atoms */
+	c = &dh->aidx[DOM_INFO(dh, e)->aidx];
+	lo = 0;
+	hi = e->nattr;
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		if (dh->attrs[c[mid]].katom < atom)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (lo < e->nattr && dh->attrs[c[lo]].katom == atom)
+		return(&dh->attrs[c[lo]]);
+	return(NULL);
+}
+
+int
+has_class(struct domhead *dh, struct dom_elem *e, uint32_t atom)
+{
+	struct elem_info *x = DOM_INFO(dh, e);
+	const uint32_t *c = &dh->cls[x->cls];
+	uint32_t lo = 0, hi = x->ncls, mid;
+
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		if (c[mid] == atom)
+			return(1);
+		if (c[mid] < atom)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return(0);
+}
+
+/*
+ * [attr~=word]: word is one of the whitespace separated words of v.  An
+ * empty word or one containing whitespace never matches.  exact is the
+ * s flag.
+ */
+int
+word_match(const char *v, size_t len, const char *word, int exact)
+{
+	const char *p, *end = v + len;
+	size_t wl, n;
+
+	wl = strlen(word);
+	if (wl == 0)
+		return(0);
+	for (n = 0; n < wl; n++) {
+		if (IS_WORDSEP(word[n]))
+			return(0);
+	}
+	for (p = v; p < end; p += n) {
+		while (p < end && IS_WORDSEP(*p))
+			p++;
+		for (n = 0; p + n < end && !IS_WORDSEP(p[n]); n++)
+			;
+		if (n != wl)
+			continue;
+		if (exact ? strncmp(p, word, wl) == 0 :
+		    strncasecmp(p, word, wl) == 0)
+			return(1);
+	}
+	return(0);
+}
+
+/* look up the atoms of the selector in this document */
+void
+sel_atoms(struct domhead *dh, struct selhead *sh)
+{
+	struct sel *s;
+	struct sel_attr *a;
+
+	TAILQ_FOREACH(s, sh, next) {
+		TAILQ_FOREACH(a, &s->attrs, next) {
+			a->katom = find_atom(dh, a->name);
+			a->atom = ATOM_NONE;
+			if (a->op == OP_CONTAINS && a->val != NULL &&
+			    a->katom == dh->class_atom)
+				a->atom = find_atom(dh, a->val);
+		}
+	}
+}
+
+void
+free_atoms(struct domhead *dh)
+{
+	free(dh->atoms);
+	free(dh->aslots);
+	free(dh->cls);
+	free(dh->aidx);
+	dh->atoms = NULL;
+	dh->aslots = dh->cls = dh->aidx = NULL;
+	dh->natoms = dh->atomsz = dh->nslots = dh->ncls = dh->clssz = 0;
+	dh->naidx = dh->aidxsz = 0;
+}
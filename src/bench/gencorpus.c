@@ -0,0 +1,307 @@
+/* $Id$ */
+/*
+ * Copyright (c) 2024 Michael Graves
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * gencorpus: write the benchmark documents.  The output only depends on
+ * the seed and scale so runs on different machines (and different days)
+ * measure the same bytes.
+ */
+
+#include "config.h"
+
+#include <sys/stat.h>
+
+#include <errno.h>
+#if HAVE_ERR
+#include <err.h>
+#endif
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static uint64_t rnd_state;
+static int scale = 1;
+
+static const char *words[] = {
+	"lorem", "ipsum", "dolor", "sit", "amet", "consectetur", "adipiscing",
+	"elit", "sed", "do", "eiusmod", "tempor", "incididunt", "ut", "labore",
+	"et", "dolore", "magna", "aliqua", "enim", "ad", "minim", "veniam",
+	"quis", "nostrud", "exercitation", "ullamco", "laboris", "nisi",
+	"aliquip", "ex", "ea", "commodo", "consequat", "&amp;", "&copy;",
+	"caf\xc3\xa9", "na\xc3\xafve"
+};
+#define NWORDS	(sizeof(words)/sizeof(words[0]))
+
+static const char *classes[] = {
+	"item", "card", "product", "row", "col", "btn", "nav", "active",
+	"hidden", "text-sm", "text-lg", "p-2", "m-4", "flex", "grid", "lead"
+};
+#define NCLASSES	(sizeof(classes)/sizeof(classes[0]))
+
+static void usage(void);
+static uint32_t rnd(uint32_t);
+static void text(FILE *, int);
+static void head(FILE *, const char *);
+static void gen_mixed(FILE *);
+static void gen_deep(FILE *);
+static void gen_wide(FILE *);
+static void gen_attrs(FILE *);
+static void gen_bigtext(FILE *);
+static void gen_unclosed(FILE *);
+static void gen_script(FILE *);
+
+static const struct {
+	const char	*name;
+	void		(*gen)(FILE *);
+} docs[] = {
+	{ "mixed",		gen_mixed },
+	{ "deep",		gen_deep },
+	{ "wide",		gen_wide },
+	{ "attrs",		gen_attrs },
+	{ "bigtext",	gen_bigtext },
+	{ "unclosed",	gen_unclosed },
+	{ "script",		gen_script },
+};
+
+extern char *__progname;
+
+static void
+usage(void)
+{
+	fprintf(stderr, "%s: [-m scale] [-s seed] directory\n", __progname);
+	exit(1);
+}
+
+/* xorshift64*, deterministic on every platform */
+static uint32_t
+rnd(uint32_t n)
+{
+	rnd_state ^= rnd_state >> 12;
+	rnd_state ^= rnd_state << 25;
+	rnd_state ^= rnd_state >> 27;
+	return((uint32_t)((rnd_state * 2685821657736338717ULL) >> 32) % n);
+}
+
+static void
+text(FILE *f, int nwords)
+{
+	int i;
+
+	for (i = 0; i < nwords; i++)
+		fprintf(f, "%s%s", i ? " " : "", words[rnd(NWORDS)]);
+}
+
+static void
+head(FILE *f, const char *title)
+{
+	fprintf(f, "<!DOCTYPE html>\n<html lang=\"en\">\n<head>\n"
+	    "<meta charset=\"utf-8\">\n<title>%s</title>\n"
+	    "<link rel=\"canonical\" href=\"https://example.com/%s\">\n"
+	    "<meta property=\"og:title\" content=\"%s\">\n</head>\n<body>\n",
+	    title, title, title);
+}
+
+/* something that looks like a shop or news page */
+static void
+gen_mixed(FILE *f)
+{
+	int i, j, n;
+
+	head(f, "mixed");
+	fprintf(f, "<div id=\"main\" class=\"container\">\n<ul class=\"nav\">\n");
+	for (i = 0; i < 20; i++)
+		fprintf(f, "<li class=\"nav-item\"><a href=\"/section/%d\">%s</a></li>\n",
+		    i, words[rnd(NWORDS)]);
+	fprintf(f, "</ul>\n");
+	n = 2000 * scale;
+	for (i = 0; i < n; i++) {
+		fprintf(f, "<div class=\"%s %s\" data-id=\"%d\">\n",
+		    classes[rnd(NCLASSES)], classes[rnd(NCLASSES)], i);
+		fprintf(f, "<!-- item %d -->\n<h2 class=\"title\">", i);
+		text(f, 3 + rnd(5));
+		fprintf(f, "</h2>\n<img src=\"/img/%d.png\" alt=\"item %d\">\n", i, i);
+		for (j = rnd(4); j >= 0; j--) {
+			fprintf(f, "<p>");
+			text(f, 10 + rnd(40));
+			fprintf(f, " <a href=\"/product/%d\" title=\"%s\">more</a></p>\n",
+			    rnd(100000), words[rnd(NWORDS)]);
+		}
+		if (rnd(4) == 0) {
+			fprintf(f, "<table>\n");
+			for (j = 0; j < 4; j++)
+				fprintf(f, "<tr><th>%s</th><td>%d</td></tr>\n",
+				    words[rnd(NWORDS)], rnd(1000));
+			fprintf(f, "</table>\n");
+		}
+		fprintf(f, "<span class=\"price\" lang=\"en-US\">%d.%02d</span><br>\n"
+		    "</div>\n", rnd(500), rnd(100));
+	}
+	fprintf(f, "</div>\n</body>\n</html>\n");
+}
+
+static void
+gen_deep(FILE *f)
+{
+	int i, n = 5000 * scale;
+
+	head(f, "deep");
+	for (i = 0; i < n; i++)
+		fprintf(f, "<div class=\"d%d\"><span>%d</span>\n", i % 10, i);
+	for (i = 0; i < n; i++)
+		fprintf(f, "</div>");
+	fprintf(f, "\n</body>\n</html>\n");
+}
+
+static void
+gen_wide(FILE *f)
+{
+	int i, n = 100000 * scale;
+
+	head(f, "wide");
+	fprintf(f, "<ul id=\"list\">\n");
+	for (i = 0; i < n; i++)
+		fprintf(f, "<li class=\"%s\">%s</li>\n", classes[rnd(NCLASSES)],
+		    words[rnd(NWORDS)]);
+	fprintf(f, "</ul>\n</body>\n</html>\n");
+}
+
+static void
+gen_attrs(FILE *f)
+{
+	int i, j, n = 10000 * scale;
+
+	head(f, "attrs");
+	for (i = 0; i < n; i++) {
+		fprintf(f, "<div id=\"a%d\" class=\"", i);
+		for (j = 0; j < 12; j++)
+			fprintf(f, "%s%s", j ? " " : "", classes[rnd(NCLASSES)]);
+		fprintf(f, "\"");
+		for (j = 0; j < 20 + (int)rnd(30); j++)
+			fprintf(f, " data-k%d=\"%s-%u\"", j, words[rnd(NWORDS)],
+			    rnd(1000));
+		fprintf(f, " hidden><a href=\"https://example.com/%u\" rel=\"nofollow\""
+		    " target=\"_blank\">x</a></div>\n", rnd(100000));
+	}
+	fprintf(f, "</body>\n</html>\n");
+}
+
+static void
+gen_bigtext(FILE *f)
+{
+	int i;
+
+	head(f, "bigtext");
+	for (i = 0; i < 4; i++) {
+		fprintf(f, "<p class=\"big\">\n");
+		text(f, 150000 * scale);
+		fprintf(f, "\n</p>\n");
+	}
+	fprintf(f, "</body>\n</html>\n");
+}
+
+/* old style markup that never closes p, li or td */
+static void
+gen_unclosed(FILE *f)
+{
+	int i, n = 5000 * scale;
+
+	head(f, "unclosed");
+	fprintf(f, "<div id=\"main\">\n");
+	for (i = 0; i < n; i++) {
+		switch (rnd(3)) {
+		case 0:
+			fprintf(f, "<p>");
+			break;
+		case 1:
+			fprintf(f, "<li>");
+			break;
+		default:
+			fprintf(f, "<td>");
+			break;
+		}
+		text(f, 5 + rnd(10));
+		fprintf(f, "\n");
+	}
+	fprintf(f, "</div>\n</body>\n</html>\n");
+}
+
+static void
+gen_script(FILE *f)
+{
+	int i, j, n = 20 * scale;
+
+	head(f, "script");
+	for (i = 0; i < n; i++) {
+		fprintf(f, "<script type=\"text/javascript\">\n");
+		for (j = 0; j < 2000; j++)
+			fprintf(f, "var v%d = \"%s\" + (a%d && b%d) + %u;\n",
+			    j, words[rnd(NWORDS)], j, j, rnd(100000));
+		fprintf(f, "</script>\n<p>");
+		text(f, 20);
+		fprintf(f, "</p>\n");
+	}
+	fprintf(f, "</body>\n</html>\n");
+}
+
+int
+main(int argc, char **argv)
+{
+	char path[PATH_MAX];
+	const char *errstr = NULL;
+	uint64_t seed = 1;
+	size_t i;
+	FILE *f;
+	int ch;
+
+	while ((ch = getopt(argc, argv, "m:s:")) != -1) {
+		switch (ch) {
+		case 'm':
+			scale = strtonum(optarg, 1, 100, &errstr);
+			if (errstr != NULL)
+				errx(1, "scale %s: %s", optarg, errstr);
+			break;
+		case 's':
+			seed = strtonum(optarg, 1, LLONG_MAX, &errstr);
+			if (errstr != NULL)
+				errx(1, "seed %s: %s", optarg, errstr);
+			break;
+		default:
+			usage();
+		}
+	}
+	argc -= optind;
+	argv += optind;
+	if (argc != 1)
+		usage();
+
+	if (mkdir(argv[0], 0755) == -1 && errno != EEXIST)
+		err(1, "mkdir %s", argv[0]);
+	for (i = 0; i < sizeof(docs)/sizeof(docs[0]); i++) {
+		/* each document has its own sequence */
+		rnd_state = seed * 0x9e3779b97f4a7c15ULL + i + 1;
+		snprintf(path, sizeof(path), "%s/%s.html", argv[0], docs[i].name);
+		if ((f = fopen(path, "w")) == NULL)
+			err(1, "%s", path);
+		docs[i].gen(f);
+		if (fclose(f) == EOF)
+			err(1, "%s", path);
+	}
+	return(0);
+}
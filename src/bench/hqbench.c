@@ -0,0 +1,424 @@
+/* $Id$ */
+/*
+ * Copyright (c) 2024 Michael Graves
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * hqbench: time each phase of hq (read, parse, match, print) over a set
+ * of documents and a fixed set of selectors.  Results are written as tab
+ * separated lines so a later run can be compared against them:
+ *
+ *	doc phase selector bytes nodes seconds MB/s nodes/s
+ *
+ * The bytes and nodes of the print phase are those printed, counted in a
+ * scratch file that stands in for the output.  A phase that printed
+ * nothing or took less than the clock can tell has no rates, they are
+ * written as -.  A results file of another version is not compared.
+ */
+
+#include "config.h"
+
+#if HAVE_SYS_QUEUE
+#include <sys/queue.h>
+#endif
+#include <sys/stat.h>
+
+#if HAVE_ERR
+#include <err.h>
+#endif
+#include <fcntl.h>
+#include <libgen.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "hq.h"
+
+#define BENCH_MAGIC		"# hqbench 2"
+
+static const char *selectors[] = {
+	"*",
+	"div",
+	"div p",
+	"div > span",
+	".item",
+	"#main",
+	"a[href^=\"/product\"]",
+	"li, td",
+	"p[title]",
+};
+#define NSELECTORS	(sizeof(selectors)/sizeof(selectors[0]))
+
+struct result {
+	char	*doc;
+	char	*phase;
+	char	*sel;
+	size_t	 bytes;
+	size_t	 nodes;
+	double	 sec;
+	int	 norate;
+};
+
+static struct result *results, *baseline;
+static size_t nresults, nbaseline;
+static int reps = 5;
+static int sink = -1;
+static double clockres;
+
+static void usage(void);
+static double now(void);
+static int dblcmp(const void *, const void *);
+static double median(double *, int);
+static void read_doc(const char *, char **, size_t *);
+static void add_result(const char *, const char *, const char *, size_t,
+    size_t, double, int);
+static void bench_doc(const char *);
+static void load_baseline(const char *);
+static struct result *find_baseline(struct result *);
+static void report(FILE *);
+static void write_results(const char *);
+
+extern char *__progname;
+
+static void
+usage(void)
+{
+	fprintf(stderr, "%s: [-n reps] [-b baseline] [-o results] file ...\n",
+	    __progname);
+	exit(1);
+}
+
+static double
+now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return(ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+static int
+dblcmp(const void *a, const void *b)
+{
+	double x = *(const double *)a, y = *(const double *)b;
+
+	return((x > y) - (x < y));
+}
+
+static double
+median(double *t, int n)
+{
+	qsort(t, n, sizeof(double), dblcmp);
+	return(t[n / 2]);
+}
+
+/* same as hq: the whole file plus the conversion to UTF-8 */
+static void
+read_doc(const char *fname, char **buf, size_t *len)
+{
+	struct stat st;
+	int fd;
+
+	if ((fd = open(fname, O_RDONLY)) == -1)
+		err(1, "%s", fname);
+	if (fstat(fd, &st) == -1)
+		err(1, "fstat");
+	*len = st.st_size;
+	if ((*buf = calloc(1, *len + 1)) == NULL)
+		err(1, "calloc");
+	if (read(fd, *buf, *len) != (ssize_t)*len)
+		errx(1, "%s: short read", fname);
+	close(fd);
+	input_utf8(buf, len, NULL);
+}
+
+static void
+add_result(const char *doc, const char *phase, const char *sel, size_t bytes,
+    size_t nodes, double sec, int empty)
+{
+	struct result *r;
+
+	if ((r = reallocarray(results, nresults + 1, sizeof(*r))) == NULL)
+		err(1, "reallocarray");
+	results = r;
+	r = &results[nresults++];
+	if ((r->doc = strdup(doc)) == NULL ||
+	    (r->phase = strdup(phase)) == NULL ||
+	    (r->sel = strdup(sel)) == NULL)
+		err(1, "strdup");
+	r->bytes = bytes;
+	r->nodes = nodes;
+	r->sec = sec;
+	r->norate = empty || sec < clockres;
+}
+
+/*
+ * every measurement is run once to warm up and then reps times, the
+ * median is kept.
+ */
+static void
+bench_doc(const char *fname)
+{
+	struct domhead dh;
+	struct selhead sh;
+	char *raw = NULL, *doc, *path, *sel;
+	size_t len = 0, nodes = 0, obytes = 0, onodes = 0, i, k;
+	double *tr, *tp, *tm, *to, t;
+	int r, saved;
+
+	if ((path = strdup(fname)) == NULL)
+		err(1, "strdup");
+	if ((doc = strdup(basename(path))) == NULL)
+		err(1, "strdup");
+	free(path);
+	if ((tr = calloc(reps, sizeof(double))) == NULL ||
+	    (tp = calloc(reps, sizeof(double))) == NULL ||
+	    (tm = calloc(reps, sizeof(double))) == NULL ||
+	    (to = calloc(reps, sizeof(double))) == NULL)
+		err(1, "calloc");
+
+	for (r = -1; r < reps; r++) {
+		free(raw);
+		t = now();
+		read_doc(fname, &raw, &len);
+		if (r >= 0)
+			tr[r] = now() - t;
+	}
+	for (r = -1; r < reps; r++) {
+		t = now();
+		if (parse_dom(&dh, raw, len) != 0 && r < 0)
+			warnx("%s: parse errors", doc);
+		if (r >= 0)
+			tp[r] = now() - t;
+		nodes = dh.nelems - 1;	/* not the root */
+		free_dom(&dh);
+	}
+	add_result(doc, "read", "-", len, nodes, median(tr, reps), 0);
+	add_result(doc, "parse", "-", len, nodes, median(tp, reps), 0);
+
+	for (i = 0; i < NSELECTORS; i++) {
+		for (r = -1; r < reps; r++) {
+			TAILQ_INIT(&sh);
+			if ((sel = strdup(selectors[i])) == NULL)
+				err(1, "strdup");
+			if (parse_sel(&sh, sel) != 0)
+				errx(1, "bad selector %s", selectors[i]);
+			free(sel);
+			parse_dom(&dh, raw, len);
+
+			t = now();
+			modify_dom(&dh, &sh, FLAG_NONE);
+			if (r >= 0)
+				tm[r] = now() - t;
+			for (onodes = 0, k = 0; k < dh.nmlist; k++) {
+				if (DOM_NODE(&dh, dh.mlist[k])->match != 0)
+					onodes++;
+			}
+
+			fflush(stdout);
+			if (ftruncate(sink, 0) == -1 ||
+			    lseek(sink, 0, SEEK_SET) == -1)
+				err(1, "sink");
+			if ((saved = dup(STDOUT_FILENO)) == -1 ||
+			    dup2(sink, STDOUT_FILENO) == -1)
+				err(1, "dup");
+			t = now();
+			print_dom(&dh, FLAG_NONE, NULL);
+			fflush(stdout);
+			if (r >= 0)
+				to[r] = now() - t;
+			obytes = lseek(sink, 0, SEEK_CUR);
+			if (dup2(saved, STDOUT_FILENO) == -1)
+				err(1, "dup2");
+			close(saved);
+
+			free_dom(&dh);
+			free_sel(&sh);
+		}
+		add_result(doc, "match", selectors[i], len, nodes,
+		    median(tm, reps), 0);
+		add_result(doc, "print", selectors[i], obytes, onodes,
+		    median(to, reps), obytes == 0);
+	}
+	free(raw);
+	free(doc);
+	free(tr);
+	free(tp);
+	free(tm);
+	free(to);
+}
+
+static void
+load_baseline(const char *fname)
+{
+	struct result *r;
+	FILE *f;
+	char *line = NULL, *p, *fld[7];
+	size_t sz = 0;
+	int n;
+
+	if ((f = fopen(fname, "r")) == NULL) {
+		warn("baseline %s", fname);
+		return;
+	}
+	if (getline(&line, &sz, f) == -1 ||
+	    strncmp(line, BENCH_MAGIC, strlen(BENCH_MAGIC)) != 0 ||
+	    (line[strlen(BENCH_MAGIC)] != '\n' &&
+	    line[strlen(BENCH_MAGIC)] != '\0')) {
+		warnx("baseline %s: another version, not compared", fname);
+		free(line);
+		fclose(f);
+		return;
+	}
+	while (getline(&line, &sz, f) != -1) {
+		if (line[0] == '#')
+			continue;
+		line[strcspn(line, "\n")] = '\0';
+		for (n = 0, p = line; n < 7 && p != NULL; n++)
+			fld[n] = strsep(&p, "\t");
+		if (n < 7)
+			continue;
+		if ((r = reallocarray(baseline, nbaseline + 1, sizeof(*r))) == NULL)
+			err(1, "reallocarray");
+		baseline = r;
+		r = &baseline[nbaseline++];
+		if ((r->doc = strdup(fld[0])) == NULL ||
+		    (r->phase = strdup(fld[1])) == NULL ||
+		    (r->sel = strdup(fld[2])) == NULL)
+			err(1, "strdup");
+		r->bytes = strtoull(fld[3], NULL, 10);
+		r->nodes = strtoull(fld[4], NULL, 10);
+		r->sec = strtod(fld[5], NULL);
+		r->norate = strcmp(fld[6], "-") == 0;
+	}
+	free(line);
+	fclose(f);
+}
+
+static struct result *
+find_baseline(struct result *r)
+{
+	size_t i;
+
+	for (i = 0; i < nbaseline; i++) {
+		if (strcmp(r->doc, baseline[i].doc) == 0 &&
+		    strcmp(r->phase, baseline[i].phase) == 0 &&
+		    strcmp(r->sel, baseline[i].sel) == 0)
+			return(&baseline[i]);
+	}
+	return(NULL);
+}
+
+static void
+report(FILE *f)
+{
+	struct result *r, *b;
+	size_t i;
+
+	fprintf(f, "%-14s %-6s %-22s %10s %12s %9s\n", "doc", "phase",
+	    "selector", "MB/s", "nodes/s", "baseline");
+	for (i = 0; i < nresults; i++) {
+		r = &results[i];
+		if (r->norate) {
+			fprintf(f, "%-14s %-6s %-22s %10s %12s\n", r->doc,
+			    r->phase, r->sel, "-", "-");
+			continue;
+		}
+		fprintf(f, "%-14s %-6s %-22s %10.1f %12.0f", r->doc, r->phase,
+		    r->sel, r->bytes / r->sec / 1e6, r->nodes / r->sec);
+		if ((b = find_baseline(r)) != NULL && b->norate)
+			;
+		else if (b != NULL && b->bytes == r->bytes)
+			fprintf(f, " %+8.1f%%", (b->sec / r->sec - 1) * 100);
+		else if (b != NULL)
+			fprintf(f, " %9s", "changed");
+		fprintf(f, "\n");
+	}
+}
+
+static void
+write_results(const char *fname)
+{
+	struct result *r;
+	FILE *f;
+	size_t i;
+
+	if ((f = fopen(fname, "w")) == NULL)
+		err(1, "%s", fname);
+	fprintf(f, "%s\n", BENCH_MAGIC);
+	fprintf(f, "# doc\tphase\tselector\tbytes\tnodes\tseconds\tMB/s\tnodes/s\n");
+	for (i = 0; i < nresults; i++) {
+		r = &results[i];
+		fprintf(f, "%s\t%s\t%s\t%zu\t%zu\t%.9f\t", r->doc,
+		    r->phase, r->sel, r->bytes, r->nodes, r->sec);
+		if (r->norate)
+			fprintf(f, "-\t-\n");
+		else
+			fprintf(f, "%.3f\t%.0f\n", r->bytes / r->sec / 1e6,
+			    r->nodes / r->sec);
+	}
+	if (fclose(f) == EOF)
+		err(1, "%s", fname);
+}
+
+int
+main(int argc, char **argv)
+{
+	struct timespec ts;
+	char tmp[] = "/tmp/hqbench.XXXXXXXXXX";
+	const char *errstr = NULL;
+	char *bfile = NULL, *ofile = NULL;
+	int ch, i;
+
+	while ((ch = getopt(argc, argv, "b:n:o:")) != -1) {
+		switch (ch) {
+		case 'b':
+			bfile = optarg;
+			break;
+		case 'n':
+			reps = strtonum(optarg, 1, 1000, &errstr);
+			if (errstr != NULL)
+				errx(1, "reps %s: %s", optarg, errstr);
+			break;
+		case 'o':
+			ofile = optarg;
+			break;
+		default:
+			usage();
+		}
+	}
+	argc -= optind;
+	argv += optind;
+	if (argc < 1)
+		usage();
+
+	if ((sink = mkstemp(tmp)) == -1)
+		err(1, "%s", tmp);
+	unlink(tmp);
+	if (clock_getres(CLOCK_MONOTONIC, &ts) == -1)
+		err(1, "clock_getres");
+	clockres = ts.tv_sec + ts.tv_nsec / 1e9;
+	if (bfile != NULL && access(bfile, R_OK) == 0)
+		load_baseline(bfile);
+	for (i = 0; i < argc; i++)
+		bench_doc(argv[i]);
+	report(stdout);
+	if (ofile != NULL)
+		write_results(ofile);
+	return(0);
+}
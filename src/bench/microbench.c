@@ -0,0 +1,438 @@
+/* $Id$ */
+/*
+ * Copyright (c) 2024 Michael Graves
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * microbench: time the hot kernels of hq on their own over inputs that
+ * are built once before timing starts.  Each kernel is run warmup times,
+ * then reps times and the distribution of the per run times is reported.
+ */
+
+#include "config.h"
+
+#if HAVE_SYS_QUEUE
+#include <sys/queue.h>
+#endif
+
+#if HAVE_ERR
+#include <err.h>
+#endif
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "hq.h"
+
+/* one element of the generated document, repeated to DOC_SIZE */
+#define DOC_UNIT \
+	"<div class=\"item card\" id=\"i%d\" data-id=\"%d\">\n" \
+	"  <!-- item -->\n" \
+	"  <h2 class=\"title\">Item &amp; more %d</h2>\n" \
+	"  <img src=\"/img/%d.png\" alt=\"item\">\n" \
+	"  <p>Lorem ipsum dolor sit amet, consectetur adipiscing elit.\n" \
+	"    <a href=\"/product/%d\" title=\"more\">more</a></p>\n" \
+	"  <span class=\"price\" lang=\"en-US\">%d.99</span><br>\n" \
+	"</div>\n"
+#define DOC_SIZE	(1024 * 1024)
+#define TEXT_SIZE	(1024 * 1024)
+/* ad block style rules, %d keeps them distinct */
+static const char *rule_fmt[] = {
+	".ad-%d",
+	"#banner-%d",
+	"div.sponsor-%d",
+	"[data-ad-%d]",
+	"aside .promo-%d",
+	"a[data-track-%d=\"ad\"]",
+	"ins%d",
+};
+#define NRULE_FMT	(sizeof(rule_fmt)/sizeof(rule_fmt[0]))
+/* and a few that match the document */
+static const char *rule_hits[] = {
+	"span.price",
+	"#i42",
+	"div > h2",
+};
+#define NRULE_HITS	(sizeof(rule_hits)/sizeof(rule_hits[0]))
+#define MAX_RULES	10000
+
+struct kernel {
+	const char	*name;
+	const char	*arg;
+	void		(*setup)(struct kernel *);
+	size_t		(*run)(struct kernel *);
+	void		(*reset)(struct kernel *);
+	size_t		 bytes;		/* processed per run */
+};
+
+static char *doc, *text, *work;
+static size_t doclen, textlen;
+static struct domhead dh;
+static struct selhead sh;
+static struct selhead *rules;
+static int nrules;
+static struct selset set;
+static int devnull = -1;
+static FILE *report;
+static int reps = 50;
+static int warmup = 5;
+
+static void usage(void);
+static double now(void);
+static int dblcmp(const void *, const void *);
+static void build_inputs(void);
+static void setup_dom(struct kernel *);
+static void setup_sel(struct kernel *);
+static void reset_match(struct kernel *);
+static void reset_text(struct kernel *);
+static void setup_rules(struct kernel *);
+static size_t run_lex(struct kernel *);
+static size_t run_match_sel(struct kernel *);
+static size_t run_check_element(struct kernel *);
+static size_t run_clean_str(struct kernel *);
+static size_t run_print_elem(struct kernel *);
+static size_t run_print_query(struct kernel *);
+static size_t run_selset(struct kernel *);
+static size_t run_linear(struct kernel *);
+static void bench(struct kernel *);
+
+static struct kernel kernels[] = {
+	{ "yylex",			NULL,		NULL,		run_lex,			NULL,		0 },
+	{ "match_sel",		"p",		setup_sel,	run_match_sel,		NULL,		0 },
+	{ "match_sel",		"a[href^=\"/product\"]",
+										setup_sel,	run_match_sel,		NULL,		0 },
+	{ "check_element",	"div p",	setup_sel,	run_check_element,	reset_match,	0 },
+	{ "check_element",	".item",	setup_sel,	run_check_element,	reset_match,	0 },
+	{ "clean_str",		NULL,		NULL,		run_clean_str,		reset_text,		0 },
+	{ "print_elem",		"*",		setup_sel,	run_print_elem,		NULL,		0 },
+	{ "print_elem",		"p",		setup_sel,	run_print_elem,		NULL,		0 },
+	/* the same output from the list of matched nodes */
+	{ "print_query",	"*",		setup_sel,	run_print_query,	NULL,		0 },
+	{ "print_query",	"p",		setup_sel,	run_print_query,	NULL,		0 },
+	/* the number of rules, linear runs match_sel() for each */
+	{ "selset",			"10",		setup_rules,	run_selset,		reset_match,	0 },
+	{ "selset",			"100",		setup_rules,	run_selset,		reset_match,	0 },
+	{ "selset",			"1000",		setup_rules,	run_selset,		reset_match,	0 },
+	{ "selset",			"10000",	setup_rules,	run_selset,		reset_match,	0 },
+	{ "linear",			"10",		setup_rules,	run_linear,		reset_match,	0 },
+	{ "linear",			"100",		setup_rules,	run_linear,		reset_match,	0 },
+};
+#define NKERNELS	(sizeof(kernels)/sizeof(kernels[0]))
+
+extern char *__progname;
+
+static void
+usage(void)
+{
+	fprintf(stderr, "%s: [-n reps] [-w warmup] [kernel ...]\n", __progname);
+	exit(1);
+}
+
+static double
+now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return(ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+static int
+dblcmp(const void *a, const void *b)
+{
+	double x = *(const double *)a, y = *(const double *)b;
+
+	return((x > y) - (x < y));
+}
+
+static void
+build_inputs(void)
+{
+	size_t off = 0, i;
+	int n;
+
+	if ((doc = calloc(1, DOC_SIZE + 1024)) == NULL)
+		err(1, "calloc");
+	for (i = 0; off < DOC_SIZE; i++) {
+		n = snprintf(doc + off, DOC_SIZE + 1024 - off, DOC_UNIT, (int)i,
+		    (int)i, (int)i, (int)i, (int)(i * 7919 % 100000), (int)i % 500);
+		off += n;
+	}
+	doclen = off;
+
+	/* text as it comes out of a pretty printed page */
+	if ((text = calloc(1, TEXT_SIZE + 1)) == NULL ||
+	    (work = calloc(1, TEXT_SIZE + 1)) == NULL)
+		err(1, "calloc");
+	for (off = 0; off + 64 < TEXT_SIZE; ) {
+		memcpy(text + off, "\n      Lorem ipsum  dolor\tsit amet,   consectetur", 48);
+		off += 48;
+	}
+	textlen = off;
+}
+
+static void
+setup_dom(struct kernel *k)
+{
+	static int parsed;
+
+	if (parsed)
+		return;
+	if (parse_dom(&dh, doc, doclen) != 0)
+		errx(1, "parse errors in generated document");
+	parsed = 1;
+}
+
+static void
+setup_sel(struct kernel *k)
+{
+	char *s;
+
+	setup_dom(k);
+	free_sel(&sh);
+	TAILQ_INIT(&sh);
+	if ((s = strdup(k->arg)) == NULL)
+		err(1, "strdup");
+	if (parse_sel(&sh, s) != 0)
+		errx(1, "bad selector %s", k->arg);
+	free(s);
+	reset_match(k);
+	/* print_elem() wants the matches in place */
+	modify_dom(&dh, &sh, FLAG_NONE);
+}
+
+static void
+reset_match(struct kernel *k)
+{
+	uint32_t i;
+
+	for (i = 0; i < dh.nelems; i++)
+		DOM_NODE(&dh, i)->match = 0;
+	reset_sel(&sh);
+}
+
+/* rules are only ever added, the heads must not move once parsed */
+static void
+setup_rules(struct kernel *k)
+{
+	const char *errstr = NULL;
+	char buf[64];
+	int i, n;
+
+	setup_dom(k);
+	n = strtonum(k->arg, 1, MAX_RULES, &errstr);
+	if (errstr != NULL)
+		errx(1, "rules %s: %s", k->arg, errstr);
+	if (rules == NULL && (rules = calloc(MAX_RULES, sizeof(*rules))) == NULL)
+		err(1, "calloc");
+	for (; nrules < n; nrules++) {
+		if ((size_t)nrules < NRULE_HITS)
+			strlcpy(buf, rule_hits[nrules], sizeof(buf));
+		else
+			snprintf(buf, sizeof(buf), rule_fmt[nrules % NRULE_FMT],
+			    nrules);
+		TAILQ_INIT(&rules[nrules]);
+		if (parse_sel(&rules[nrules], buf) != 0)
+			errx(1, "bad rule %s", buf);
+	}
+	selset_free(&set);
+	for (i = 0; i < n; i++) {
+		selset_add(&set, &rules[i]);
+		reset_sel(&rules[i]);
+		sel_prepare(&dh, &rules[i]);
+	}
+}
+
+static void
+reset_text(struct kernel *k)
+{
+	memcpy(work, text, textlen + 1);
+}
+
+static size_t
+run_lex(struct kernel *k)
+{
+	k->bytes = doclen;
+	return(lex_dom(doc, doclen));
+}
+
+/* match_sel() over every node, without the recursion of check_element() */
+static size_t
+run_match_sel(struct kernel *k)
+{
+	uint32_t i;
+	size_t n = 0;
+
+	k->bytes = doclen;
+	reset_sel(&sh);
+	for (i = 1; i < dh.nelems; i++)
+		n += match_sel(&dh, DOM_NODE(&dh, i), &sh, FLAG_NONE);
+	return(n);
+}
+
+static size_t
+run_check_element(struct kernel *k)
+{
+	struct dom_elem *e;
+	size_t n = 0;
+
+	k->bytes = doclen;
+	DOM_FOREACH_CHILD(e, &dh, DOM_NODE(&dh, DOM_ROOT))
+		n += check_element(&dh, e, &sh, FLAG_NONE);
+	return(n);
+}
+
+static size_t
+run_clean_str(struct kernel *k)
+{
+	k->bytes = textlen;
+	return(strlen(clean_str(work)));
+}
+
+static size_t
+run_print_elem(struct kernel *k)
+{
+	struct dom_elem *e;
+
+	k->bytes = doclen;
+	DOM_FOREACH_CHILD(e, &dh, DOM_NODE(&dh, DOM_ROOT))
+		print_elem(&dh, e, FLAG_NONE, 0, NULL);
+	fflush(stdout);
+	return(0);
+}
+
+static size_t
+run_print_query(struct kernel *k)
+{
+	k->bytes = doclen;
+	print_query(&dh, FLAG_NONE, NULL, QUERY_BIT(0), NULL);
+	fflush(stdout);
+	return(0);
+}
+
+static size_t
+run_selset(struct kernel *k)
+{
+	k->bytes = doclen;
+	set.tests = 0;
+	selset_match(&dh, &set, QUERY_BIT(0));
+	return(set.tests);
+}
+
+static size_t
+run_linear(struct kernel *k)
+{
+	struct dom_elem *e;
+	uint32_t i;
+	size_t n = 0;
+	int j;
+
+	k->bytes = doclen;
+	for (j = 0; j < (int)set.nheads; j++)
+		reset_sel(set.heads[j]);
+	for (i = 1; i < dh.nelems; i++) {
+		e = DOM_NODE(&dh, i);
+		for (j = 0; j < (int)set.nheads; j++) {
+			if (match_sel(&dh, e, set.heads[j], FLAG_NONE) == 1) {
+				e->match = 1;
+				n++;
+			}
+		}
+	}
+	return(n);
+}
+
+static void
+bench(struct kernel *k)
+{
+	double *t, t0, p50;
+	volatile size_t sink = 0;
+	int i;
+
+	if ((t = calloc(reps, sizeof(double))) == NULL)
+		err(1, "calloc");
+	if (k->setup != NULL)
+		k->setup(k);
+	for (i = -warmup; i < reps; i++) {
+		if (k->reset != NULL)
+			k->reset(k);
+		t0 = now();
+		sink += k->run(k);
+		if (i >= 0)
+			t[i] = now() - t0;
+	}
+	qsort(t, reps, sizeof(double), dblcmp);
+	p50 = t[reps / 2];
+	fprintf(report, "%-14s %-22s %9.1f %9.1f %9.1f %9.1f %9.1f %9.1f\n", k->name,
+	    k->arg ? k->arg : "-", t[0] * 1e6, p50 * 1e6,
+	    t[reps * 90 / 100] * 1e6, t[reps * 99 / 100] * 1e6,
+	    t[reps - 1] * 1e6, k->bytes / p50 / 1e6);
+	free(t);
+}
+
+int
+main(int argc, char **argv)
+{
+	const char *errstr = NULL;
+	size_t i;
+	int ch, j, saved;
+
+	while ((ch = getopt(argc, argv, "n:w:")) != -1) {
+		switch (ch) {
+		case 'n':
+			reps = strtonum(optarg, 1, 100000, &errstr);
+			if (errstr != NULL)
+				errx(1, "reps %s: %s", optarg, errstr);
+			break;
+		case 'w':
+			warmup = strtonum(optarg, 0, 100000, &errstr);
+			if (errstr != NULL)
+				errx(1, "warmup %s: %s", optarg, errstr);
+			break;
+		default:
+			usage();
+		}
+	}
+	argc -= optind;
+	argv += optind;
+
+	build_inputs();
+	TAILQ_INIT(&sh);
+	if ((devnull = open("/dev/null", O_WRONLY)) == -1)
+		err(1, "/dev/null");
+	/* the report goes to a copy of stdout, print_elem() to /dev/null */
+	if ((saved = dup(STDOUT_FILENO)) == -1 ||
+	    (report = fdopen(saved, "w")) == NULL)
+		err(1, "dup");
+	if (dup2(devnull, STDOUT_FILENO) == -1)
+		err(1, "dup2");
+
+	fprintf(report, "%-14s %-22s %9s %9s %9s %9s %9s %9s\n", "kernel", "input",
+	    "min us", "p50 us", "p90 us", "p99 us", "max us", "MB/s");
+	for (i = 0; i < NKERNELS; i++) {
+		for (j = 0; j < argc; j++)
+			if (strcmp(argv[j], kernels[i].name) == 0)
+				break;
+		if (argc > 0 && j == argc)
+			continue;
+		bench(&kernels[i]);
+	}
+	fclose(report);
+	return(0);
+}
@@ -0,0 +1,305 @@
+/* $Id$ */
+/*
+ * Copyright (c) 2024 Michael Graves
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * changes to the document written as splices into the input: a range of
+ * the source replaced by a string, possibly empty.  The input is copied
+ * out between them so the cost is that of the few changes, not of the
+ * document.
+ */
+
+#include "config.h"
+
+#if HAVE_SYS_QUEUE
+#include <sys/queue.h>
+#endif
+
+#if HAVE_ERR
+#include <err.h>
+#endif
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "hq.h"
+
+struct splice {
+	uint32_t	off;
+	uint32_t	len;
+	const char	*str;
+	size_t		slen;
+	uint32_t	seq;		/* keeps the order of those at one offset */
+};
+
+static int splice_cmp(const void *, const void *);
+static char *escape(const char *, int);
+static uint32_t attr_end(struct domhead *, struct attr_elem *);
+static void edit_elem(struct domhead *, struct dom_elem *, struct edit *);
+
+static struct splice *splices;
+static uint32_t nsplices, splicesz;
+
+void
+splice_add(uint32_t off, uint32_t len, const char *str, size_t slen)
+{
+	struct splice *s;
+	uint32_t n;
+
+	if (nsplices == splicesz) {
+		n = splicesz ? splicesz * 2 : 256;
+		if ((s = reallocarray(splices, n, sizeof(*s))) == NULL)
+			err(1, "reallocarray");
+		alloc_bytes += (n - splicesz) * sizeof(*s);
+		splices = s;
+		splicesz = n;
+	}
+	s = &splices[nsplices];
+	s->off = off;
+	s->len = len;
+	s->str = str;
+	s->slen = slen;
+	s->seq = nsplices++;
+}
+
+static int
+splice_cmp(const void *a, const void *b)
+{
+	const struct splice *x = a, *y = b;
+
+	if (x->off != y->off)
+		return(x->off < y->off ? -1 : 1);
+	return(x->seq < y->seq ? -1 : x->seq > y->seq);
+}
+
+/*
+ * write the input with the splices made.  One that starts inside the
+ * range of an earlier one is dropped, its bytes are already gone.
+ */
+void
+splice_write(struct domhead *dh)
+{
+	struct splice *s;
+	uint32_t k, pos = 0;
+
+	/* end tags come after the nodes inside */
+	if (nsplices > 1)
+		qsort(splices, nsplices, sizeof(*splices), splice_cmp);
+	for (k = 0; k < nsplices; k++) {
+		s = &splices[k];
+		if (s->off >= pos) {
+			fwrite(dh->raw + pos, 1, s->off - pos, stdout);
+			fwrite(s->str, 1, s->slen, stdout);
+			pos = s->off;
+		}
+		if (s->off + s->len > pos)
+			pos = s->off + s->len;
+	}
+	if (dh->rawlen > pos)
+		fwrite(dh->raw + pos, 1, dh->rawlen - pos, stdout);
+	nsplices = 0;
+}
+
+/* str with the characters html gives a meaning to as references */
+static char *
+escape(const char *str, int attr)
+{
+	const char *r;
+	char *buf, *p;
+
+	if ((buf = malloc(strlen(str) * 6 + 1)) == NULL)
+		err(1, "malloc");
+	for (p = buf; *str != '\0'; str++) {
+		switch (*str) {
+		case '&':
+			r = "&amp;";
+			break;
+		case '"':
+			r = attr ? "&quot;" : NULL;
+			break;
+		case '<':
+			r = attr ? NULL : "&lt;";
+			break;
+		case '>':
+			r = attr ? NULL : "&gt;";
+			break;
+		default:
+			r = NULL;
+			break;
+		}
+		if (r == NULL)
+			*p++ = *str;
+		else
+			p = stpcpy(p, r);
+	}
+	*p = '\0';
+	return(buf);
+}
+
+/*
+ * -s name=value, -u name, -T text or -w.  The string to write is made
+ * once here.
+ */
+void
+edit_parse(struct edit *ed, int op, const char *arg)
+{
+	const char *v;
+	char *s;
+
+	memset(ed, 0, sizeof(*ed));
+	ed->op = op;
+	switch (op) {
+	case EDIT_SET:
+		if ((v = strchr(arg, '=')) == NULL || v == arg)
+			errx(1, "%s: expecting name=value", arg);
+		if ((ed->name = strndup(arg, v - arg)) == NULL)
+			err(1, "strndup");
+		s = escape(v + 1, 1);
+		/* with a space to add it, without to replace one */
+		if (asprintf(&ed->str, " %s=\"%s\"", ed->name, s) == -1)
+			err(1, "asprintf");
+		free(s);
+		break;
+	case EDIT_UNSET:
+		if (arg[0] == '\0')
+			errx(1, "empty attribute name");
+		if ((ed->name = strdup(arg)) == NULL)
+			err(1, "strdup");
+		break;
+	case EDIT_TEXT:
+		ed->str = escape(arg, 0);
+		break;
+	case EDIT_UNWRAP:
+		break;
+	}
+	if (ed->str != NULL)
+		ed->len = strlen(ed->str);
+}
+
+/* a and b change the same attribute, the text or the tags */
+int
+edit_same(const struct edit *a, const struct edit *b)
+{
+	if (a->name != NULL && b->name != NULL)
+		return(strcasecmp(a->name, b->name) == 0);
+	return(a->op == b->op);
+}
+
+void
+edit_free(struct edit *ed)
+{
+	free(ed->name);
+	free(ed->str);
+}
+
+/* the end of the attribute in the source, with its value and quotes */
+static uint32_t
+attr_end(struct domhead *dh, struct attr_elem *a)
+{
+	uint32_t p, q;
+	char c;
+
+	p = a->key.off + a->key.len;
+	for (q = p; q < dh->rawlen && isspace((unsigned char)dh->raw[q]); q++)
+		;
+	if (q == dh->rawlen || dh->raw[q] != '=')
+		return(p);
+	for (q++; q < dh->rawlen && isspace((unsigned char)dh->raw[q]); q++)
+		;
+	if (q < dh->rawlen && (dh->raw[q] == '"' || dh->raw[q] == '\'')) {
+		c = dh->raw[q];
+		for (q++; q < dh->rawlen && dh->raw[q] != c; q++)
+			;
+		return(q < dh->rawlen ? q + 1 : q);
+	}
+	while (q < dh->rawlen && dh->raw[q] != '>' &&
+	    !isspace((unsigned char)dh->raw[q]))
+		q++;
+	return(q);
+}
+
+static void
+edit_elem(struct domhead *dh, struct dom_elem *e, struct edit *ed)
+{
+	struct attr_elem *a;
+	struct span tag, etag;
+	uint32_t p, q;
+	int found = 0;
+
+	node_span(dh, e, &tag, &etag);
+	switch (ed->op) {
+	case EDIT_SET:
+	case EDIT_UNSET:
+		DOM_FOREACH_ATTR(a, dh, e) {
+			if (span_strcasecmp(dh, a->key, ed->name) != 0)
+				continue;
+			found = 1;
+			p = a->key.off;
+			q = attr_end(dh, a);
+			if (ed->op == EDIT_SET) {
+				splice_add(p, q - p, ed->str + 1, ed->len - 1);
+				continue;
+			}
+			/* the space before it goes too */
+			while (p > tag.off && isspace((unsigned char)dh->raw[p - 1]))
+				p--;
+			splice_add(p, q - p, "", 0);
+		}
+		if (found || ed->op == EDIT_UNSET)
+			break;
+		/* before the > or /> of the tag */
+		p = tag.off + tag.len;
+		if (p > tag.off && dh->raw[p - 1] == '>')
+			p--;
+		if (p > tag.off && dh->raw[p - 1] == '/')
+			p--;
+		splice_add(p, 0, ed->str, ed->len);
+		break;
+	case EDIT_TEXT:
+		if (e->flags & (ELEM_NOEND|ELEM_INLINE))
+			break;
+		p = tag.off + tag.len;
+		q = etag.len != 0 ? etag.off : node_end(dh, e);
+		splice_add(p, q > p ? q - p : 0, ed->str, ed->len);
+		break;
+	case EDIT_UNWRAP:
+		splice_add(tag.off, tag.len, "", 0);
+		if (etag.len != 0)
+			splice_add(etag.off, etag.len, "", 0);
+		break;
+	}
+}
+
+/* the input with the edits made to the elements matched by mask */
+void
+print_edits(struct domhead *dh, struct edit *ed, int ned, uint16_t mask)
+{
+	struct dom_elem *e;
+	uint32_t k;
+	int i;
+
+	for (k = 0; k < dh->nmlist; k++) {
+		e = DOM_NODE(dh, dh->mlist[k]);
+		if (e->type != DOMF_ELEM || (e->match & mask) == 0)
+			continue;
+		for (i = 0; i < ned; i++)
+			edit_elem(dh, e, &ed[i]);
+	}
+	splice_write(dh);
+}
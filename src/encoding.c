@@ -0,0 +1,324 @@
+/* $Id$ */
+/*
+ * Copyright (c) 2024 Michael Graves
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "config.h"
+
+#if HAVE_SYS_QUEUE
+#include <sys/queue.h>
+#endif
+
+#include <ctype.h>
+#if HAVE_ERR
+#include <err.h>
+#endif
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "hq.h"
+
+#define SNIFF_LEN		1024		/* bytes searched for <meta charset> */
+#define ASCII_MASK		0x8080808080808080ULL
+
+/* windows-1252 0x80 - 0x9f, the undefined bytes map to themselves */
+const uint16_t cp1252_c1[32] = {
+	0x20ac, 0x0081, 0x201a, 0x0192, 0x201e, 0x2026, 0x2020, 0x2021,
+	0x02c6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008d, 0x017d, 0x008f,
+	0x0090, 0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014,
+	0x02dc, 0x2122, 0x0161, 0x203a, 0x0153, 0x009d, 0x017e, 0x0178
+};
+
+/* as in the WHATWG encoding spec the latin1 labels are windows-1252 */
+static const struct {
+	const char	*label;
+	int			 enc;
+} charsets[] = {
+	{ "utf-8",				ENC_UTF8 },
+	{ "utf8",				ENC_UTF8 },
+	{ "unicode-1-1-utf-8",	ENC_UTF8 },
+	{ "windows-1252",		ENC_CP1252 },
+	{ "cp1252",				ENC_CP1252 },
+	{ "x-cp1252",			ENC_CP1252 },
+	{ "iso-8859-1",			ENC_CP1252 },
+	{ "iso8859-1",			ENC_CP1252 },
+	{ "iso_8859-1",			ENC_CP1252 },
+	{ "latin1",				ENC_CP1252 },
+	{ "l1",					ENC_CP1252 },
+	{ "cp819",				ENC_CP1252 },
+	{ "ibm819",				ENC_CP1252 },
+	{ "us-ascii",			ENC_CP1252 },
+	{ "ascii",				ENC_CP1252 },
+};
+
+static size_t utf8_seqlen(const unsigned char *, size_t);
+static int sniff_meta(const char *, size_t);
+static char *repair_utf8(const char *, size_t, size_t, size_t *);
+static char *cp1252_to_utf8(const char *, size_t, size_t *);
+
+int
+charset_enc(const char *label)
+{
+	size_t i;
+
+	for (i = 0; i < sizeof(charsets)/sizeof(charsets[0]); i++) {
+		if (strcasecmp(label, charsets[i].label) == 0)
+			return(charsets[i].enc);
+	}
+	return(ENC_AUTO);
+}
+
+size_t
+put_utf8(char *p, uint32_t c)
+{
+	if (c < 0x80) {
+		p[0] = c;
+		return(1);
+	}
+	if (c < 0x800) {
+		p[0] = 0xc0 | (c >> 6);
+		p[1] = 0x80 | (c & 0x3f);
+		return(2);
+	}
+	if (c < 0x10000) {
+		p[0] = 0xe0 | (c >> 12);
+		p[1] = 0x80 | ((c >> 6) & 0x3f);
+		p[2] = 0x80 | (c & 0x3f);
+		return(3);
+	}
+	p[0] = 0xf0 | (c >> 18);
+	p[1] = 0x80 | ((c >> 12) & 0x3f);
+	p[2] = 0x80 | ((c >> 6) & 0x3f);
+	p[3] = 0x80 | (c & 0x3f);
+	return(4);
+}
+
+/* length of the well formed multibyte sequence at s or 0 */
+static size_t
+utf8_seqlen(const unsigned char *s, size_t left)
+{
+	unsigned char lo = 0x80, hi = 0xbf;
+	size_t n, i;
+
+	if (s[0] >= 0xc2 && s[0] <= 0xdf)
+		n = 2;
+	else if (s[0] >= 0xe0 && s[0] <= 0xef) {
+		n = 3;
+		if (s[0] == 0xe0)
+			lo = 0xa0;
+		else if (s[0] == 0xed)
+			hi = 0x9f;		/* no surrogates */
+	} else if (s[0] >= 0xf0 && s[0] <= 0xf4) {
+		n = 4;
+		if (s[0] == 0xf0)
+			lo = 0x90;
+		else if (s[0] == 0xf4)
+			hi = 0x8f;		/* nothing above U+10FFFF */
+	} else
+		return(0);
+	if (left < n)
+		return(0);
+	if (s[1] < lo || s[1] > hi)
+		return(0);
+	for (i = 2; i < n; i++) {
+		if (s[i] < 0x80 || s[i] > 0xbf)
+			return(0);
+	}
+	return(n);
+}
+
+/*
+ * return the length of the valid UTF-8 prefix of buf, len if it is all
+ * valid.  Runs of ASCII are skipped 32 bytes at a time by testing the
+ * high bit of four words at once, so typical html is checked at close to
+ * memory speed and only the multibyte sequences go through utf8_seqlen().
+ */
+size_t
+utf8_valid(const char *buf, size_t len)
+{
+	const unsigned char *s = (const unsigned char *)buf;
+	uint64_t w[4];
+	size_t i = 0, n;
+
+	while (i < len) {
+		while (i + sizeof(w) <= len) {
+			memcpy(w, s + i, sizeof(w));
+			if (((w[0] | w[1] | w[2] | w[3]) & ASCII_MASK) != 0)
+				break;
+			i += sizeof(w);
+		}
+		for (; i < len && s[i] < 0x80; i++)
+			;
+		if (i == len)
+			break;
+		if ((n = utf8_seqlen(s + i, len - i)) == 0)
+			return(i);
+		i += n;
+	}
+	return(len);
+}
+
+/*
+ * look for <meta charset="x"> or <meta content="text/html; charset=x">
+ * near the top of the document.
+ */
+static int
+sniff_meta(const char *buf, size_t len)
+{
+	const char *p, *end, *tend;
+	char label[32];
+	size_t l;
+
+	end = buf + (len < SNIFF_LEN ? len : SNIFF_LEN);
+	for (p = buf; p + 5 < end; p++) {
+		if (*p != '<' || strncasecmp(p + 1, "meta", 4) != 0)
+			continue;
+		for (tend = p; tend < end && *tend != '>'; tend++)
+			;
+		for (p += 5; p + 7 < tend; p++) {
+			if (strncasecmp(p, "charset", 7) != 0)
+				continue;
+			p += 7;
+			while (p < tend && isspace((unsigned char)*p))
+				p++;
+			if (p >= tend || *p++ != '=')
+				continue;
+			while (p < tend && (isspace((unsigned char)*p) ||
+			    *p == '"' || *p == '\''))
+				p++;
+			for (l = 0; p < tend && l < sizeof(label) - 1 &&
+			    (isalnum((unsigned char)*p) || strchr("-_.:", *p) != NULL);
+			    p++, l++)
+				label[l] = *p;
+			label[l] = '\0';
+			if (l == 0)
+				continue;
+			/* read as if there were no declaration */
+			if (charset_enc(label) == ENC_AUTO)
+				warnx("unsupported charset %s, "
+				    "assuming utf-8, else windows-1252", label);
+			return(charset_enc(label));
+		}
+		p = tend;
+	}
+	return(ENC_AUTO);
+}
+
+/* copy buf replacing each invalid byte with U+FFFD, bad is the first one */
+static char *
+repair_utf8(const char *buf, size_t len, size_t bad, size_t *olen)
+{
+	char *out, *o;
+	size_t n;
+
+	/* worst case every byte becomes a 3 byte replacement */
+	if ((out = calloc(1, len * 3 + 1)) == NULL)
+		err(1, "calloc");
+	alloc_bytes += len * 3 + 1;
+	memcpy(out, buf, bad);
+	o = out + bad;
+	while (bad < len) {
+		o += put_utf8(o, 0xfffd);
+		bad++;
+		n = utf8_valid(buf + bad, len - bad);
+		memcpy(o, buf + bad, n);
+		o += n;
+		bad += n;
+	}
+	*o = '\0';
+	*olen = o - out;
+	return(out);
+}
+
+static char *
+cp1252_to_utf8(const char *buf, size_t len, size_t *olen)
+{
+	const unsigned char *s = (const unsigned char *)buf;
+	char *out, *o;
+	size_t i;
+
+	if ((out = calloc(1, len * 3 + 1)) == NULL)
+		err(1, "calloc");
+	alloc_bytes += len * 3 + 1;
+	for (i = 0, o = out; i < len; i++) {
+		if (s[i] < 0x80)
+			*o++ = s[i];
+		else if (s[i] < 0xa0)
+			o += put_utf8(o, cp1252_c1[s[i] - 0x80]);
+		else
+			o += put_utf8(o, s[i]);
+	}
+	*o = '\0';
+	*olen = o - out;
+	return(out);
+}
+
+/*
+ * convert the input buffer to UTF-8 in place.  The encoding is taken from
+ * charset if given, then a byte order mark, then a <meta> declaration.
+ * Undeclared input that is not valid UTF-8 is taken as windows-1252 and
+ * invalid bytes in UTF-8 input are replaced with U+FFFD.  Returns the
+ * encoding the input was read as.
+ */
+int
+input_utf8(char **buf, size_t *len, const char *charset)
+{
+	unsigned char *s = (unsigned char *)*buf;
+	char *out = NULL;
+	size_t bom = 0, v, olen;
+	int enc = ENC_AUTO;
+
+	if (charset != NULL && (enc = charset_enc(charset)) == ENC_AUTO)
+		errx(1, "unsupported charset %s", charset);
+	if (*len >= 2 && ((s[0] == 0xfe && s[1] == 0xff) ||
+	    (s[0] == 0xff && s[1] == 0xfe)))
+		errx(1, "UTF-16 input is not supported");
+	if (*len >= 3 && s[0] == 0xef && s[1] == 0xbb && s[2] == 0xbf) {
+		enc = ENC_UTF8;
+		bom = 3;
+	}
+	if (enc == ENC_AUTO)
+		enc = sniff_meta(*buf, *len);
+
+	if (enc != ENC_CP1252) {
+		v = utf8_valid(*buf + bom, *len - bom);
+		if (v == *len - bom) {
+			if (bom) {
+				memmove(*buf, *buf + bom, *len - bom + 1);
+				*len -= bom;
+			}
+			return(ENC_UTF8);
+		}
+		if (enc == ENC_UTF8)
+			out = repair_utf8(*buf + bom, *len - bom, v, &olen);
+		else
+			enc = ENC_CP1252;
+	}
+	if (enc == ENC_CP1252) {
+		/* nothing to do for plain ASCII */
+		for (v = 0; v < *len && s[v] < 0x80; v++)
+			;
+		if (v == *len)
+			return(enc);
+		out = cp1252_to_utf8(*buf, *len, &olen);
+	}
+	free(*buf);
+	*buf = out;
+	*len = olen;
+	return(enc);
+}
@@ -0,0 +1,313 @@
+/* $Id$ */
+/*
+ * Copyright (c) 2024 Michael Graves
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "config.h"
+
+#if HAVE_SYS_QUEUE
+#include <sys/queue.h>
+#endif
+
+#include <ctype.h>
+#if HAVE_ERR
+#include <err.h>
+#endif
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hq.h"
+
+struct entity {
+	const char	*name;
+	const char	*value;
+};
+
+#include "entities.h"
+
+#define ENT_MAXNAME		32		/* longest name in the table */
+#define ENT_MAXLEGACY	6		/* longest name allowed without ';' */
+
+static uint32_t ent_hash(uint32_t, const char *, size_t);
+static const char *ent_lookup(const char *, size_t);
+static size_t decode_numeric(const char *, const char *, char **);
+static size_t decode_named(const char *, const char *, char **, int);
+static const char *cached_value(char ***, uint32_t, uint32_t, const char *,
+    struct span, int, size_t *);
+
+/* same FNV-1a as mkentities.py */
+static uint32_t
+ent_hash(uint32_t seed, const char *s, size_t len)
+{
+	uint32_t h = 2166136261U ^ seed;
+
+	while (len-- > 0) {
+		h ^= (unsigned char)*s++;
+		h *= 16777619U;
+	}
+	return(h);
+}
+
+/* return the UTF-8 expansion of the entity name or NULL */
+static const char *
+ent_lookup(const char *name, size_t len)
+{
+	const struct entity *e;
+	uint32_t b;
+
+	b = ent_hash(0, name, len) % ENT_BUCKETS;
+	e = &ent_tab[ent_hash(ent_disp[b], name, len) % ENT_COUNT];
+	if (strncmp(e->name, name, len) == 0 && e->name[len] == '\0')
+		return(e->value);
+	return(NULL);
+}
+
+/*
+ * s points at "&#".  Returns the number of input bytes consumed or 0
+ * if this is not a numeric reference.
+ */
+static size_t
+decode_numeric(const char *s, const char *end, char **out)
+{
+	const char *p = s + 2;
+	uint32_t c = 0;
+	int hex = 0, digits = 0;
+
+	if (p < end && (*p == 'x' || *p == 'X')) {
+		hex = 1;
+		p++;
+	}
+	for (; p < end; p++, digits++) {
+		if (isdigit((unsigned char)*p))
+			c = c * (hex ? 16 : 10) + (*p - '0');
+		else if (hex && isxdigit((unsigned char)*p))
+			c = c * 16 + (tolower((unsigned char)*p) - 'a' + 10);
+		else
+			break;
+		if (c > 0x10ffff)
+			c = 0x110000;	/* saturate, replaced below */
+	}
+	if (digits == 0)
+		return(0);
+	if (p < end && *p == ';')
+		p++;
+	if (c == 0 || c > 0x10ffff || (c >= 0xd800 && c <= 0xdfff))
+		c = 0xfffd;
+	else if (c >= 0x80 && c <= 0x9f)
+		c = cp1252_c1[c - 0x80];	/* taken as windows-1252 */
+	*out += put_utf8(*out, c);
+	return(p - s);
+}
+
+/*
+ * s points at "&".  Try the full name with ';' first, then the longest
+ * legacy name that may appear without one.  In attribute values a legacy
+ * name followed by an alphanumeric or '=' is left alone.
+ */
+static size_t
+decode_named(const char *s, const char *end, char **out, int inattr)
+{
+	const char *p = s + 1, *v;
+	size_t len, l;
+
+	for (len = 0; len < ENT_MAXNAME && p + len < end &&
+	    isalnum((unsigned char)p[len]); len++)
+		;
+	if (len == 0)
+		return(0);
+	if (p + len < end && p[len] == ';' &&
+	    (v = ent_lookup(p, len + 1)) != NULL) {
+		l = len + 1;
+		goto found;
+	}
+	for (l = (len < ENT_MAXLEGACY ? len : ENT_MAXLEGACY); l >= 2; l--) {
+		if ((v = ent_lookup(p, l)) == NULL)
+			continue;
+		if (inattr && p + l < end &&
+		    (isalnum((unsigned char)p[l]) || p[l] == '='))
+			return(0);
+		goto found;
+	}
+	return(0);
+found:
+	len = strlen(v);
+	memcpy(*out, v, len);
+	*out += len;
+	return(l + 1);
+}
+
+/*
+ * return a newly allocated copy of the len bytes at str with character
+ * references decoded or NULL if there are none.
+ */
+char *
+decode_entities(const char *str, size_t len, int inattr)
+{
+	const char *s, *end = str + len;
+	char *buf, *o;
+	size_t n;
+
+	if ((s = memchr(str, '&', len)) == NULL)
+		return(NULL);
+	/* no reference expands to more than twice its length */
+	if ((buf = calloc(1, len * 2 + 1)) == NULL)
+		err(1, "calloc");
+	alloc_bytes += len * 2 + 1;
+	memcpy(buf, str, s - str);
+	o = buf + (s - str);
+	while (s < end) {
+		if (*s != '&') {
+			*o++ = *s++;
+			continue;
+		}
+		if (s + 1 < end && s[1] == '#')
+			n = decode_numeric(s, end, &o);
+		else
+			n = decode_named(s, end, &o, inattr);
+		if (n == 0)
+			*o++ = *s++;
+		else
+			s += n;
+	}
+	*o = '\0';
+	return(buf);
+}
+
+/*
+ * decoded attribute and text values.  Decoding is done on first use and
+ * cached by node, values that are never compared or printed are never
+ * decoded.  Values without references point straight into the source.
+ */
+static char nodecode[1];
+
+static const char *
+cached_value(char ***cache, uint32_t n, uint32_t i, const char *src,
+    struct span v, int inattr, size_t *len)
+{
+	char *d;
+
+	if (*cache == NULL) {
+		if ((*cache = calloc(n, sizeof(char *))) == NULL)
+			err(1, "calloc");
+		alloc_bytes += n * sizeof(char *);
+	}
+	if ((*cache)[i] == NULL) {
+		if ((d = decode_entities(src, v.len, inattr)) == NULL)
+			d = nodecode;
+		(*cache)[i] = d;
+	}
+	if ((*cache)[i] == nodecode) {
+		*len = v.len;
+		return(src);
+	}
+	*len = strlen((*cache)[i]);
+	return((*cache)[i]);
+}
+
+/* NULL for an attribute without a value */
+const char *
+attr_value(struct domhead *dh, struct attr_elem *a, size_t *len)
+{
+	if (a->value.off == 0) {
+		*len = 0;
+		return(NULL);
+	}
+	return(cached_value(&dh->dattr, dh->nattrs, a - dh->attrs,
+	    DOM_STR(dh, a->value), a->value, 1, len));
+}
+
+const char *
+text_value(struct domhead *dh, struct dom_elem *e, size_t *len)
+{
+	return(cached_value(&dh->dtext, dh->nelems, DOM_IDX(dh, e),
+	    DOM_STR(dh, e->value), e->value, 0, len));
+}
+
+/*
+ * the decoded text of every text node end to end in document order.  The
+ * subtree of a node is contiguous so its text is the slice from toff[i]
+ * to toff[end + 1], built once however many elements are asked about.
+ */
+void
+dom_text(struct domhead *dh)
+{
+	struct dom_elem *e;
+	const char *v;
+	size_t len, n = 0, sz = 0, nsz;
+	uint32_t i, ws;
+	char *p;
+
+	if (dh->toff != NULL)
+		return;
+	if ((dh->toff = calloc(dh->nelems + 1, sizeof(*dh->toff))) == NULL)
+		err(1, "calloc");
+	alloc_bytes += (dh->nelems + 1) * sizeof(*dh->toff);
+	for (i = 0; i < dh->nelems; i++) {
+		dh->toff[i] = n;
+		e = DOM_NODE(dh, i);
+		if (e->type != DOMF_TEXT)
+			continue;
+		v = text_value(dh, e, &len);
+		/* the lexer skips the white space a text node starts with */
+		for (ws = 0; ws < e->value.off &&
+		    isspace((unsigned char)dh->raw[e->value.off - ws - 1]); ws++)
+			;
+		/* and a NUL, for regexec(3) without REG_STARTEND */
+		if (n + ws + len + 1 > sz) {
+			for (nsz = sz ? sz : 4096; nsz < n + ws + len + 1; nsz *= 2)
+				;
+			if ((p = realloc(dh->text, nsz)) == NULL)
+				err(1, "realloc");
+			alloc_bytes += nsz - sz;
+			dh->text = p;
+			sz = nsz;
+		}
+		memcpy(dh->text + n, dh->raw + e->value.off - ws, ws);
+		memcpy(dh->text + n + ws, v, len);
+		n += ws + len;
+	}
+	if (dh->text == NULL && (dh->text = malloc(1)) == NULL)
+		err(1, "malloc");
+	dh->text[n] = '\0';
+	dh->toff[dh->nelems] = n;
+	dh->ntext = n;
+}
+
+void
+free_values(struct domhead *dh)
+{
+	uint32_t i;
+
+	if (dh->dtext != NULL) {
+		for (i = 0; i < dh->nelems; i++)
+			if (dh->dtext[i] != nodecode)
+				free(dh->dtext[i]);
+		free(dh->dtext);
+	}
+	if (dh->dattr != NULL) {
+		for (i = 0; i < dh->nattrs; i++)
+			if (dh->dattr[i] != nodecode)
+				free(dh->dattr[i]);
+		free(dh->dattr);
+	}
+	dh->dtext = dh->dattr = NULL;
+	free(dh->text);
+	free(dh->toff);
+	dh->text = NULL;
+	dh->toff = NULL;
+	dh->ntext = 0;
+}
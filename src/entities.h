@@ -0,0 +1,2288 @@
+/* generated by mkentities.py, do not edit */
+
+#define ENT_COUNT	2231
+#define ENT_BUCKETS	557
+
+static const uint16_t ent_disp[ENT_BUCKETS] = {
+	16, 67, 9, 11, 67, 329, 79, 21, 8, 126, 55, 96,
+	116, 21, 0, 19, 58, 9, 77, 111, 231, 1, 13, 61,
+	5, 44, 1, 40, 1, 240, 85, 12, 8, 174, 77, 1,
+	21, 53, 1, 25, 308, 25, 1, 11, 141, 153, 19, 227,
+	59, 7, 2, 15, 195, 4, 1, 11, 7, 68, 2, 10,
+	21, 95, 167, 1, 59, 19, 95, 217, 137, 116, 88, 1,
+	5, 39, 143, 226, 77, 67, 27, 30, 164, 218, 13, 82,
+	3, 248, 4, 103, 18, 4, 102, 75, 25, 12, 13, 182,
+	6, 58, 3, 2, 10, 15, 13, 111, 214, 130, 70, 1,
+	49, 3, 7, 451, 1, 2, 7, 85, 1, 13, 75, 233,
+	79, 276, 2, 89, 57, 29, 195, 18, 381, 9, 94, 14,
+	18, 46, 2, 8, 38, 229, 1, 7, 13, 10, 3, 1,
+	2, 9, 20, 5, 125, 89, 250, 3, 407, 3, 34, 259,
+	9, 78, 5, 5, 247, 12, 23, 2, 20, 4, 2, 1,
+	951, 26, 347, 220, 4, 66, 2, 2, 112, 182, 89, 5,
+	1, 1, 66, 80, 294, 12, 2, 65, 188, 21, 12, 18,
+	8, 113, 38, 21, 1, 175, 4, 6, 199, 327, 15, 68,
+	2, 68, 2, 11, 28, 23, 167, 55, 36, 1, 18, 0,
+	324, 25, 4, 1, 0, 534, 74, 213, 7, 1, 42, 151,
+	1, 30, 142, 31, 24, 121, 1, 2, 14, 198, 20, 51,
+	14, 1, 50, 69, 1, 694, 1, 121, 8, 39, 33, 15,
+	0, 350, 30, 9, 1, 88, 291, 136, 338, 8, 254, 13,
+	188, 1, 106, 3, 79, 7, 1, 59, 84, 220, 204, 40,
+	315, 11, 7, 3, 152, 193, 151, 552, 50, 0, 108, 257,
+	203, 73, 140, 302, 1, 808, 3, 168, 15, 12, 143, 1,
+	9, 697, 204, 8, 81, 62, 172, 18, 9, 4, 134, 353,
+	26, 8, 294, 149, 305, 3, 12, 78, 0, 316, 1, 3,
+	2, 4, 59, 9, 150, 123, 20, 46, 62, 716, 363, 227,
+	12, 518, 157, 42, 309, 26, 568, 34, 1, 239, 9, 11,
+	236, 135, 694, 104, 422, 132, 1, 138, 11, 52, 21, 1,
+	1106, 3, 148, 702, 7, 875, 3, 6, 5, 4, 778, 179,
+	316, 23, 1, 292, 2, 202, 70, 49, 189, 4, 701, 23,
+	10, 522, 751, 64, 12, 131, 4, 69, 34, 769, 64, 872,
+	182, 358, 39, 316, 3, 274, 1022, 680, 60, 41, 166, 67,
+	24, 314, 33, 16, 12, 1188, 500, 872, 18, 497, 3, 52,
+	338, 63, 152, 112, 856, 19, 764, 133, 76, 16, 192, 517,
+	1, 226, 1808, 174, 2, 1034, 5, 2, 1, 264, 1156, 107,
+	0, 270, 131, 454, 557, 2481, 57, 663, 8, 1, 24, 106,
+	178, 291, 104, 219, 10, 270, 243, 53, 3, 20, 12, 266,
+	2072, 3, 1, 412, 44, 60, 31, 477, 67, 788, 548, 701,
+	1, 3, 530, 18, 96, 448, 13, 16, 145, 1563, 584, 30,
+	431, 1, 12, 145, 1, 1383, 67, 628, 625, 1329, 10, 13,
+	1408, 33, 79, 4412, 1, 310, 214, 159, 104, 62, 606, 720,
+	305, 12, 465, 5, 262, 2428, 991, 37, 149, 16, 186, 63,
+	486, 2, 881, 5731, 2, 10, 187, 9, 1, 307, 6, 82,
+	71, 33, 6, 1663, 353, 2109, 1695, 593, 1, 5, 1, 338,
+	28, 15, 103, 455, 524,
+};
+
+static const struct entity ent_tab[ENT_COUNT] = {
+	{ "int;", "\xe2\x88\xab" },
+	{ "angmsdag;", "\xe2\xa6\xae" },
+	{ "eogon;", "\xc4\x99" },
+	{ "lrm;", "\xe2\x80\x8e" },
+	{ "fallingdotseq;", "\xe2\x89\x92" },
+	{ "Zdot;", "\xc5\xbb" },
+	{ "ovbar;", "\xe2\x8c\xbd" },
+	{ "nis;", "\xe2\x8b\xbc" },
+	{ "rightleftarrows;", "\xe2\x87\x84" },
+	{ "lsaquo;", "\xe2\x80\xb9" },
+	{ "realine;", "\xe2\x84\x9b" },
+	{ "Product;", "\xe2\x88\x8f" },
+	{ "dzcy;", "\xd1\x9f" },
+	{ "dHar;", "\xe2\xa5\xa5" },
+	{ "sccue;", "\xe2\x89\xbd" },
+	{ "llarr;", "\xe2\x87\x87" },
+	{ "Gcy;", "\xd0\x93" },
+	{ "nsubset;", "\xe2\x8a\x82\xe2\x83\x92" },
+	{ "oplus;", "\xe2\x8a\x95" },
+	{ "verbar;", "\x7c" },
+	{ "ohbar;", "\xe2\xa6\xb5" },
+	{ "lgE;", "\xe2\xaa\x91" },
+	{ "Eta;", "\xce\x97" },
+	{ "Yscr;", "\xf0\x9d\x92\xb4" },
+	{ "Breve;", "\xcb\x98" },
+	{ "DownRightVector;", "\xe2\x87\x81" },
+	{ "SucceedsTilde;", "\xe2\x89\xbf" },
+	{ "rhard;", "\xe2\x87\x81" },
+	{ "RightCeiling;", "\xe2\x8c\x89" },
+	{ "asympeq;", "\xe2\x89\x8d" },
+	{ "cedil", "\xc2\xb8" },
+	{ "bumpE;", "\xe2\xaa\xae" },
+	{ "nwnear;", "\xe2\xa4\xa7" },
+	{ "rceil;", "\xe2\x8c\x89" },
+	{ "copf;", "\xf0\x9d\x95\x94" },
+	{ "ngeqslant;", "\xe2\xa9\xbe\xcc\xb8" },
+	{ "ucy;", "\xd1\x83" },
+	{ "subseteq;", "\xe2\x8a\x86" },
+	{ "nleftarrow;", "\xe2\x86\x9a" },
+	{ "ape;", "\xe2\x89\x8a" },
+	{ "searhk;", "\xe2\xa4\xa5" },
+	{ "vee;", "\xe2\x88\xa8" },
+	{ "ExponentialE;", "\xe2\x85\x87" },
+	{ "commat;", "\x40" },
+	{ "Kfr;", "\xf0\x9d\x94\x8e" },
+	{ "uHar;", "\xe2\xa5\xa3" },
+	{ "Bopf;", "\xf0\x9d\x94\xb9" },
+	{ "ii;", "\xe2\x85\x88" },
+	{ "smte;", "\xe2\xaa\xac" },
+	{ "NegativeMediumSpace;", "\xe2\x80\x8b" },
+	{ "Upsilon;", "\xce\xa5" },
+	{ "boxVR;", "\xe2\x95\xa0" },
+	{ "succeq;", "\xe2\xaa\xb0" },
+	{ "Jcy;", "\xd0\x99" },
+	{ "Ocirc", "\xc3\x94" },
+	{ "xwedge;", "\xe2\x8b\x80" },
+	{ "prime;", "\xe2\x80\xb2" },
+	{ "InvisibleTimes;", "\xe2\x81\xa2" },
+	{ "nGg;", "\xe2\x8b\x99\xcc\xb8" },
+	{ "sqsubset;", "\xe2\x8a\x8f" },
+	{ "scsim;", "\xe2\x89\xbf" },
+	{ "gopf;", "\xf0\x9d\x95\x98" },
+	{ "gcirc;", "\xc4\x9d" },
+	{ "lessgtr;", "\xe2\x89\xb6" },
+	{ "downarrow;", "\xe2\x86\x93" },
+	{ "multimap;", "\xe2\x8a\xb8" },
+	{ "lsqb;", "\x5b" },
+	{ "uparrow;", "\xe2\x86\x91" },
+	{ "risingdotseq;", "\xe2\x89\x93" },
+	{ "nvrArr;", "\xe2\xa4\x83" },
+	{ "OElig;", "\xc5\x92" },
+	{ "amalg;", "\xe2\xa8\xbf" },
+	{ "lparlt;", "\xe2\xa6\x93" },
+	{ "euro;", "\xe2\x82\xac" },
+	{ "Subset;", "\xe2\x8b\x90" },
+	{ "Otilde", "\xc3\x95" },
+	{ "gesdot;", "\xe2\xaa\x80" },
+	{ "swarr;", "\xe2\x86\x99" },
+	{ "ell;", "\xe2\x84\x93" },
+	{ "wscr;", "\xf0\x9d\x93\x8c" },
+	{ "longleftarrow;", "\xe2\x9f\xb5" },
+	{ "gtrarr;", "\xe2\xa5\xb8" },
+	{ "DownRightVectorBar;", "\xe2\xa5\x97" },
+	{ "Hscr;", "\xe2\x84\x8b" },
+	{ "mscr;", "\xf0\x9d\x93\x82" },
+	{ "Precedes;", "\xe2\x89\xba" },
+	{ "Cdot;", "\xc4\x8a" },
+	{ "scirc;", "\xc5\x9d" },
+	{ "nleqq;", "\xe2\x89\xa6\xcc\xb8" },
+	{ "micro", "\xc2\xb5" },
+	{ "yacy;", "\xd1\x8f" },
+	{ "gtreqless;", "\xe2\x8b\x9b" },
+	{ "UnderBar;", "\x5f" },
+	{ "qscr;", "\xf0\x9d\x93\x86" },
+	{ "vArr;", "\xe2\x87\x95" },
+	{ "straightepsilon;", "\xcf\xb5" },
+	{ "Hat;", "\x5e" },
+	{ "rarrsim;", "\xe2\xa5\xb4" },
+	{ "NotSquareSuperset;", "\xe2\x8a\x90\xcc\xb8" },
+	{ "hbar;", "\xe2\x84\x8f" },
+	{ "RightVector;", "\xe2\x87\x80" },
+	{ "cuvee;", "\xe2\x8b\x8e" },
+	{ "lesssim;", "\xe2\x89\xb2" },
+	{ "gt", "\x3e" },
+	{ "Rcy;", "\xd0\xa0" },
+	{ "Otimes;", "\xe2\xa8\xb7" },
+	{ "cacute;", "\xc4\x87" },
+	{ "Ffr;", "\xf0\x9d\x94\x89" },
+	{ "Bernoullis;", "\xe2\x84\xac" },
+	{ "boxDL;", "\xe2\x95\x97" },
+	{ "omega;", "\xcf\x89" },
+	{ "angst;", "\xc3\x85" },
+	{ "nbump;", "\xe2\x89\x8e\xcc\xb8" },
+	{ "comp;", "\xe2\x88\x81" },
+	{ "nlt;", "\xe2\x89\xae" },
+	{ "Copf;", "\xe2\x84\x82" },
+	{ "prE;", "\xe2\xaa\xb3" },
+	{ "boxdL;", "\xe2\x95\x95" },
+	{ "Yuml;", "\xc5\xb8" },
+	{ "trianglelefteq;", "\xe2\x8a\xb4" },
+	{ "duarr;", "\xe2\x87\xb5" },
+	{ "NotGreaterSlantEqual;", "\xe2\xa9\xbe\xcc\xb8" },
+	{ "Star;", "\xe2\x8b\x86" },
+	{ "vangrt;", "\xe2\xa6\x9c" },
+	{ "nLeftrightarrow;", "\xe2\x87\x8e" },
+	{ "lcedil;", "\xc4\xbc" },
+	{ "gsim;", "\xe2\x89\xb3" },
+	{ "notinva;", "\xe2\x88\x89" },
+	{ "Egrave;", "\xc3\x88" },
+	{ "DownTee;", "\xe2\x8a\xa4" },
+	{ "Aring", "\xc3\x85" },
+	{ "plusmn", "\xc2\xb1" },
+	{ "Ocirc;", "\xc3\x94" },
+	{ "iinfin;", "\xe2\xa7\x9c" },
+	{ "Tau;", "\xce\xa4" },
+	{ "NegativeThickSpace;", "\xe2\x80\x8b" },
+	{ "xrArr;", "\xe2\x9f\xb9" },
+	{ "larrpl;", "\xe2\xa4\xb9" },
+	{ "Iuml", "\xc3\x8f" },
+	{ "lbrksld;", "\xe2\xa6\x8f" },
+	{ "nsubseteq;", "\xe2\x8a\x88" },
+	{ "angmsdab;", "\xe2\xa6\xa9" },
+	{ "seswar;", "\xe2\xa4\xa9" },
+	{ "igrave", "\xc3\xac" },
+	{ "nhArr;", "\xe2\x87\x8e" },
+	{ "bigotimes;", "\xe2\xa8\x82" },
+	{ "ncedil;", "\xc5\x86" },
+	{ "uplus;", "\xe2\x8a\x8e" },
+	{ "supne;", "\xe2\x8a\x8b" },
+	{ "frac18;", "\xe2\x85\x9b" },
+	{ "Zeta;", "\xce\x96" },
+	{ "NotGreaterTilde;", "\xe2\x89\xb5" },
+	{ "ngsim;", "\xe2\x89\xb5" },
+	{ "Dscr;", "\xf0\x9d\x92\x9f" },
+	{ "plusdu;", "\xe2\xa8\xa5" },
+	{ "Jcirc;", "\xc4\xb4" },
+	{ "setmn;", "\xe2\x88\x96" },
+	{ "precneqq;", "\xe2\xaa\xb5" },
+	{ "nvsim;", "\xe2\x88\xbc\xe2\x83\x92" },
+	{ "TildeEqual;", "\xe2\x89\x83" },
+	{ "Theta;", "\xce\x98" },
+	{ "vsubnE;", "\xe2\xab\x8b\xef\xb8\x80" },
+	{ "parsim;", "\xe2\xab\xb3" },
+	{ "blacktriangledown;", "\xe2\x96\xbe" },
+	{ "Ncy;", "\xd0\x9d" },
+	{ "zcaron;", "\xc5\xbe" },
+	{ "Dashv;", "\xe2\xab\xa4" },
+	{ "phi;", "\xcf\x86" },
+	{ "vsupne;", "\xe2\x8a\x8b\xef\xb8\x80" },
+	{ "breve;", "\xcb\x98" },
+	{ "succcurlyeq;", "\xe2\x89\xbd" },
+	{ "dotplus;", "\xe2\x88\x94" },
+	{ "hksearow;", "\xe2\xa4\xa5" },
+	{ "barwedge;", "\xe2\x8c\x85" },
+	{ "efDot;", "\xe2\x89\x92" },
+	{ "ratail;", "\xe2\xa4\x9a" },
+	{ "backcong;", "\xe2\x89\x8c" },
+	{ "backepsilon;", "\xcf\xb6" },
+	{ "lnapprox;", "\xe2\xaa\x89" },
+	{ "nsimeq;", "\xe2\x89\x84" },
+	{ "lneqq;", "\xe2\x89\xa8" },
+	{ "NotGreaterFullEqual;", "\xe2\x89\xa7\xcc\xb8" },
+	{ "tau;", "\xcf\x84" },
+	{ "hybull;", "\xe2\x81\x83" },
+	{ "thorn;", "\xc3\xbe" },
+	{ "notin;", "\xe2\x88\x89" },
+	{ "circledast;", "\xe2\x8a\x9b" },
+	{ "Longrightarrow;", "\xe2\x9f\xb9" },
+	{ "ltimes;", "\xe2\x8b\x89" },
+	{ "Dstrok;", "\xc4\x90" },
+	{ "ltrPar;", "\xe2\xa6\x96" },
+	{ "lE;", "\xe2\x89\xa6" },
+	{ "nharr;", "\xe2\x86\xae" },
+	{ "Psi;", "\xce\xa8" },
+	{ "iacute;", "\xc3\xad" },
+	{ "odash;", "\xe2\x8a\x9d" },
+	{ "searr;", "\xe2\x86\x98" },
+	{ "NotSucceedsTilde;", "\xe2\x89\xbf\xcc\xb8" },
+	{ "GreaterSlantEqual;", "\xe2\xa9\xbe" },
+	{ "larr;", "\xe2\x86\x90" },
+	{ "slarr;", "\xe2\x86\x90" },
+	{ "thetasym;", "\xcf\x91" },
+	{ "approx;", "\xe2\x89\x88" },
+	{ "sqcaps;", "\xe2\x8a\x93\xef\xb8\x80" },
+	{ "varepsilon;", "\xcf\xb5" },
+	{ "leqq;", "\xe2\x89\xa6" },
+	{ "Tcedil;", "\xc5\xa2" },
+	{ "Fscr;", "\xe2\x84\xb1" },
+	{ "leg;", "\xe2\x8b\x9a" },
+	{ "Rscr;", "\xe2\x84\x9b" },
+	{ "Lcedil;", "\xc4\xbb" },
+	{ "ngE;", "\xe2\x89\xa7\xcc\xb8" },
+	{ "curarr;", "\xe2\x86\xb7" },
+	{ "lang;", "\xe2\x9f\xa8" },
+	{ "topcir;", "\xe2\xab\xb1" },
+	{ "bopf;", "\xf0\x9d\x95\x93" },
+	{ "middot", "\xc2\xb7" },
+	{ "KJcy;", "\xd0\x8c" },
+	{ "rightharpoondown;", "\xe2\x87\x81" },
+	{ "ngt;", "\xe2\x89\xaf" },
+	{ "dtri;", "\xe2\x96\xbf" },
+	{ "Ccedil", "\xc3\x87" },
+	{ "hcirc;", "\xc4\xa5" },
+	{ "atilde", "\xc3\xa3" },
+	{ "acy;", "\xd0\xb0" },
+	{ "bbrk;", "\xe2\x8e\xb5" },
+	{ "dcaron;", "\xc4\x8f" },
+	{ "boxvr;", "\xe2\x94\x9c" },
+	{ "boxminus;", "\xe2\x8a\x9f" },
+	{ "prsim;", "\xe2\x89\xbe" },
+	{ "naturals;", "\xe2\x84\x95" },
+	{ "downharpoonright;", "\xe2\x87\x82" },
+	{ "triangleleft;", "\xe2\x97\x83" },
+	{ "curlyeqprec;", "\xe2\x8b\x9e" },
+	{ "xodot;", "\xe2\xa8\x80" },
+	{ "ffr;", "\xf0\x9d\x94\xa3" },
+	{ "LeftRightArrow;", "\xe2\x86\x94" },
+	{ "squarf;", "\xe2\x96\xaa" },
+	{ "Leftrightarrow;", "\xe2\x87\x94" },
+	{ "ShortLeftArrow;", "\xe2\x86\x90" },
+	{ "bernou;", "\xe2\x84\xac" },
+	{ "drcorn;", "\xe2\x8c\x9f" },
+	{ "Pscr;", "\xf0\x9d\x92\xab" },
+	{ "wp;", "\xe2\x84\x98" },
+	{ "Aring;", "\xc3\x85" },
+	{ "fork;", "\xe2\x8b\x94" },
+	{ "ngtr;", "\xe2\x89\xaf" },
+	{ "race;", "\xe2\x88\xbd\xcc\xb1" },
+	{ "shy;", "\xc2\xad" },
+	{ "els;", "\xe2\xaa\x95" },
+	{ "harr;", "\xe2\x86\x94" },
+	{ "Cup;", "\xe2\x8b\x93" },
+	{ "And;", "\xe2\xa9\x93" },
+	{ "half;", "\xc2\xbd" },
+	{ "quot;", "\x22" },
+	{ "npolint;", "\xe2\xa8\x94" },
+	{ "quaternions;", "\xe2\x84\x8d" },
+	{ "disin;", "\xe2\x8b\xb2" },
+	{ "RightTeeVector;", "\xe2\xa5\x9b" },
+	{ "yuml;", "\xc3\xbf" },
+	{ "ograve", "\xc3\xb2" },
+	{ "rdsh;", "\xe2\x86\xb3" },
+	{ "TildeTilde;", "\xe2\x89\x88" },
+	{ "Colon;", "\xe2\x88\xb7" },
+	{ "otimesas;", "\xe2\xa8\xb6" },
+	{ "gsiml;", "\xe2\xaa\x90" },
+	{ "quatint;", "\xe2\xa8\x96" },
+	{ "Uparrow;", "\xe2\x87\x91" },
+	{ "Sacute;", "\xc5\x9a" },
+	{ "and;", "\xe2\x88\xa7" },
+	{ "ETH;", "\xc3\x90" },
+	{ "yuml", "\xc3\xbf" },
+	{ "ordm", "\xc2\xba" },
+	{ "rharu;", "\xe2\x87\x80" },
+	{ "Congruent;", "\xe2\x89\xa1" },
+	{ "oint;", "\xe2\x88\xae" },
+	{ "lbarr;", "\xe2\xa4\x8c" },
+	{ "minus;", "\xe2\x88\x92" },
+	{ "uuml", "\xc3\xbc" },
+	{ "ordf;", "\xc2\xaa" },
+	{ "Supset;", "\xe2\x8b\x91" },
+	{ "ultri;", "\xe2\x97\xb8" },
+	{ "jukcy;", "\xd1\x94" },
+	{ "Sopf;", "\xf0\x9d\x95\x8a" },
+	{ "uacute;", "\xc3\xba" },
+	{ "NotGreaterEqual;", "\xe2\x89\xb1" },
+	{ "vDash;", "\xe2\x8a\xa8" },
+	{ "RightAngleBracket;", "\xe2\x9f\xa9" },
+	{ "supmult;", "\xe2\xab\x82" },
+	{ "Egrave", "\xc3\x88" },
+	{ "supsetneqq;", "\xe2\xab\x8c" },
+	{ "boxvh;", "\xe2\x94\xbc" },
+	{ "triangleright;", "\xe2\x96\xb9" },
+	{ "hstrok;", "\xc4\xa7" },
+	{ "LT;", "\x3c" },
+	{ "lrtri;", "\xe2\x8a\xbf" },
+	{ "planckh;", "\xe2\x84\x8e" },
+	{ "Vdashl;", "\xe2\xab\xa6" },
+	{ "prap;", "\xe2\xaa\xb7" },
+	{ "notniva;", "\xe2\x88\x8c" },
+	{ "bcong;", "\xe2\x89\x8c" },
+	{ "subseteqq;", "\xe2\xab\x85" },
+	{ "nisd;", "\xe2\x8b\xba" },
+	{ "mapstodown;", "\xe2\x86\xa7" },
+	{ "hscr;", "\xf0\x9d\x92\xbd" },
+	{ "Efr;", "\xf0\x9d\x94\x88" },
+	{ "lcaron;", "\xc4\xbe" },
+	{ "capdot;", "\xe2\xa9\x80" },
+	{ "supsetneq;", "\xe2\x8a\x8b" },
+	{ "djcy;", "\xd1\x92" },
+	{ "SuchThat;", "\xe2\x88\x8b" },
+	{ "weierp;", "\xe2\x84\x98" },
+	{ "eqcolon;", "\xe2\x89\x95" },
+	{ "Lambda;", "\xce\x9b" },
+	{ "DownTeeArrow;", "\xe2\x86\xa7" },
+	{ "curvearrowright;", "\xe2\x86\xb7" },
+	{ "leftrightharpoons;", "\xe2\x87\x8b" },
+	{ "lBarr;", "\xe2\xa4\x8e" },
+	{ "boxvL;", "\xe2\x95\xa1" },
+	{ "lnap;", "\xe2\xaa\x89" },
+	{ "DoubleRightTee;", "\xe2\x8a\xa8" },
+	{ "psi;", "\xcf\x88" },
+	{ "ugrave;", "\xc3\xb9" },
+	{ "Equal;", "\xe2\xa9\xb5" },
+	{ "mldr;", "\xe2\x80\xa6" },
+	{ "acute;", "\xc2\xb4" },
+	{ "profalar;", "\xe2\x8c\xae" },
+	{ "gacute;", "\xc7\xb5" },
+	{ "bot;", "\xe2\x8a\xa5" },
+	{ "DownRightTeeVector;", "\xe2\xa5\x9f" },
+	{ "Ropf;", "\xe2\x84\x9d" },
+	{ "rlarr;", "\xe2\x87\x84" },
+	{ "lozenge;", "\xe2\x97\x8a" },
+	{ "starf;", "\xe2\x98\x85" },
+	{ "gscr;", "\xe2\x84\x8a" },
+	{ "DiacriticalAcute;", "\xc2\xb4" },
+	{ "ltrie;", "\xe2\x8a\xb4" },
+	{ "hairsp;", "\xe2\x80\x8a" },
+	{ "blacklozenge;", "\xe2\xa7\xab" },
+	{ "ccirc;", "\xc4\x89" },
+	{ "zeta;", "\xce\xb6" },
+	{ "simne;", "\xe2\x89\x86" },
+	{ "lAtail;", "\xe2\xa4\x9b" },
+	{ "varsupsetneqq;", "\xe2\xab\x8c\xef\xb8\x80" },
+	{ "glj;", "\xe2\xaa\xa4" },
+	{ "NotElement;", "\xe2\x88\x89" },
+	{ "rbrke;", "\xe2\xa6\x8c" },
+	{ "DiacriticalDot;", "\xcb\x99" },
+	{ "dfr;", "\xf0\x9d\x94\xa1" },
+	{ "Aopf;", "\xf0\x9d\x94\xb8" },
+	{ "UpArrowDownArrow;", "\xe2\x87\x85" },
+	{ "ogon;", "\xcb\x9b" },
+	{ "leftharpoondown;", "\xe2\x86\xbd" },
+	{ "DownArrowUpArrow;", "\xe2\x87\xb5" },
+	{ "nesim;", "\xe2\x89\x82\xcc\xb8" },
+	{ "CenterDot;", "\xc2\xb7" },
+	{ "vBarv;", "\xe2\xab\xa9" },
+	{ "Ocy;", "\xd0\x9e" },
+	{ "TripleDot;", "\xe2\x83\x9b" },
+	{ "intcal;", "\xe2\x8a\xba" },
+	{ "in;", "\xe2\x88\x88" },
+	{ "LessLess;", "\xe2\xaa\xa1" },
+	{ "PlusMinus;", "\xc2\xb1" },
+	{ "Larr;", "\xe2\x86\x9e" },
+	{ "HilbertSpace;", "\xe2\x84\x8b" },
+	{ "abreve;", "\xc4\x83" },
+	{ "lsime;", "\xe2\xaa\x8d" },
+	{ "iopf;", "\xf0\x9d\x95\x9a" },
+	{ "LeftArrowBar;", "\xe2\x87\xa4" },
+	{ "it;", "\xe2\x81\xa2" },
+	{ "DJcy;", "\xd0\x82" },
+	{ "rcaron;", "\xc5\x99" },
+	{ "gdot;", "\xc4\xa1" },
+	{ "elinters;", "\xe2\x8f\xa7" },
+	{ "npar;", "\xe2\x88\xa6" },
+	{ "zwnj;", "\xe2\x80\x8c" },
+	{ "ycirc;", "\xc5\xb7" },
+	{ "Cacute;", "\xc4\x86" },
+	{ "toea;", "\xe2\xa4\xa8" },
+	{ "DownBreve;", "\xcc\x91" },
+	{ "nsqsube;", "\xe2\x8b\xa2" },
+	{ "cupcap;", "\xe2\xa9\x86" },
+	{ "upsih;", "\xcf\x92" },
+	{ "nsime;", "\xe2\x89\x84" },
+	{ "npr;", "\xe2\x8a\x80" },
+	{ "Eopf;", "\xf0\x9d\x94\xbc" },
+	{ "order;", "\xe2\x84\xb4" },
+	{ "puncsp;", "\xe2\x80\x88" },
+	{ "lharu;", "\xe2\x86\xbc" },
+	{ "Nopf;", "\xe2\x84\x95" },
+	{ "Jscr;", "\xf0\x9d\x92\xa5" },
+	{ "raquo;", "\xc2\xbb" },
+	{ "NotSubset;", "\xe2\x8a\x82\xe2\x83\x92" },
+	{ "NotEqual;", "\xe2\x89\xa0" },
+	{ "larrsim;", "\xe2\xa5\xb3" },
+	{ "RightDoubleBracket;", "\xe2\x9f\xa7" },
+	{ "LeftArrow;", "\xe2\x86\x90" },
+	{ "ecir;", "\xe2\x89\x96" },
+	{ "otilde", "\xc3\xb5" },
+	{ "Rightarrow;", "\xe2\x87\x92" },
+	{ "rangle;", "\xe2\x9f\xa9" },
+	{ "gel;", "\xe2\x8b\x9b" },
+	{ "napos;", "\xc5\x89" },
+	{ "sime;", "\xe2\x89\x83" },
+	{ "Kcedil;", "\xc4\xb6" },
+	{ "frasl;", "\xe2\x81\x84" },
+	{ "pre;", "\xe2\xaa\xaf" },
+	{ "roarr;", "\xe2\x87\xbe" },
+	{ "rlhar;", "\xe2\x87\x8c" },
+	{ "boxDR;", "\xe2\x95\x94" },
+	{ "Hcirc;", "\xc4\xa4" },
+	{ "csup;", "\xe2\xab\x90" },
+	{ "flat;", "\xe2\x99\xad" },
+	{ "nearr;", "\xe2\x86\x97" },
+	{ "sscr;", "\xf0\x9d\x93\x88" },
+	{ "nbumpe;", "\xe2\x89\x8f\xcc\xb8" },
+	{ "lhard;", "\xe2\x86\xbd" },
+	{ "yacute;", "\xc3\xbd" },
+	{ "rtrif;", "\xe2\x96\xb8" },
+	{ "GreaterGreater;", "\xe2\xaa\xa2" },
+	{ "dot;", "\xcb\x99" },
+	{ "rsquor;", "\xe2\x80\x99" },
+	{ "Coproduct;", "\xe2\x88\x90" },
+	{ "numsp;", "\xe2\x80\x87" },
+	{ "Gg;", "\xe2\x8b\x99" },
+	{ "upuparrows;", "\xe2\x87\x88" },
+	{ "rarrlp;", "\xe2\x86\xac" },
+	{ "lnsim;", "\xe2\x8b\xa6" },
+	{ "sol;", "\x2f" },
+	{ "GreaterLess;", "\xe2\x89\xb7" },
+	{ "gneqq;", "\xe2\x89\xa9" },
+	{ "nshortparallel;", "\xe2\x88\xa6" },
+	{ "NJcy;", "\xd0\x8a" },
+	{ "egrave", "\xc3\xa8" },
+	{ "bigcup;", "\xe2\x8b\x83" },
+	{ "measuredangle;", "\xe2\x88\xa1" },
+	{ "rbrksld;", "\xe2\xa6\x8e" },
+	{ "Uarr;", "\xe2\x86\x9f" },
+	{ "bbrktbrk;", "\xe2\x8e\xb6" },
+	{ "Darr;", "\xe2\x86\xa1" },
+	{ "origof;", "\xe2\x8a\xb6" },
+	{ "xharr;", "\xe2\x9f\xb7" },
+	{ "GJcy;", "\xd0\x83" },
+	{ "lurdshar;", "\xe2\xa5\x8a" },
+	{ "xcirc;", "\xe2\x97\xaf" },
+	{ "twixt;", "\xe2\x89\xac" },
+	{ "vartheta;", "\xcf\x91" },
+	{ "bottom;", "\xe2\x8a\xa5" },
+	{ "lsquo;", "\xe2\x80\x98" },
+	{ "Jsercy;", "\xd0\x88" },
+	{ "jcy;", "\xd0\xb9" },
+	{ "Euml", "\xc3\x8b" },
+	{ "Union;", "\xe2\x8b\x83" },
+	{ "ddarr;", "\xe2\x87\x8a" },
+	{ "emsp14;", "\xe2\x80\x85" },
+	{ "or;", "\xe2\x88\xa8" },
+	{ "NewLine;", "\x0a" },
+	{ "Ascr;", "\xf0\x9d\x92\x9c" },
+	{ "ShortUpArrow;", "\xe2\x86\x91" },
+	{ "ctdot;", "\xe2\x8b\xaf" },
+	{ "angmsd;", "\xe2\x88\xa1" },
+	{ "Acy;", "\xd0\x90" },
+	{ "LowerLeftArrow;", "\xe2\x86\x99" },
+	{ "acE;", "\xe2\x88\xbe\xcc\xb3" },
+	{ "topbot;", "\xe2\x8c\xb6" },
+	{ "pound", "\xc2\xa3" },
+	{ "boxh;", "\xe2\x94\x80" },
+	{ "subplus;", "\xe2\xaa\xbf" },
+	{ "rbbrk;", "\xe2\x9d\xb3" },
+	{ "lEg;", "\xe2\xaa\x8b" },
+	{ "rmoust;", "\xe2\x8e\xb1" },
+	{ "pointint;", "\xe2\xa8\x95" },
+	{ "bump;", "\xe2\x89\x8e" },
+	{ "rdca;", "\xe2\xa4\xb7" },
+	{ "fltns;", "\xe2\x96\xb1" },
+	{ "bprime;", "\xe2\x80\xb5" },
+	{ "larrlp;", "\xe2\x86\xab" },
+	{ "Rcaron;", "\xc5\x98" },
+	{ "Pr;", "\xe2\xaa\xbb" },
+	{ "ImaginaryI;", "\xe2\x85\x88" },
+	{ "suplarr;", "\xe2\xa5\xbb" },
+	{ "profsurf;", "\xe2\x8c\x93" },
+	{ "horbar;", "\xe2\x80\x95" },
+	{ "napprox;", "\xe2\x89\x89" },
+	{ "ruluhar;", "\xe2\xa5\xa8" },
+	{ "angmsdac;", "\xe2\xa6\xaa" },
+	{ "Popf;", "\xe2\x84\x99" },
+	{ "Sqrt;", "\xe2\x88\x9a" },
+	{ "gl;", "\xe2\x89\xb7" },
+	{ "fjlig;", "\x66\x6a" },
+	{ "nsupset;", "\xe2\x8a\x83\xe2\x83\x92" },
+	{ "Igrave;", "\xc3\x8c" },
+	{ "isinE;", "\xe2\x8b\xb9" },
+	{ "olcir;", "\xe2\xa6\xbe" },
+	{ "minusb;", "\xe2\x8a\x9f" },
+	{ "leftharpoonup;", "\xe2\x86\xbc" },
+	{ "Vscr;", "\xf0\x9d\x92\xb1" },
+	{ "nsube;", "\xe2\x8a\x88" },
+	{ "nles;", "\xe2\xa9\xbd\xcc\xb8" },
+	{ "NegativeVeryThinSpace;", "\xe2\x80\x8b" },
+	{ "twoheadrightarrow;", "\xe2\x86\xa0" },
+	{ "nearhk;", "\xe2\xa4\xa4" },
+	{ "rpar;", "\x29" },
+	{ "Udblac;", "\xc5\xb0" },
+	{ "Assign;", "\xe2\x89\x94" },
+	{ "lbbrk;", "\xe2\x9d\xb2" },
+	{ "Lcy;", "\xd0\x9b" },
+	{ "numero;", "\xe2\x84\x96" },
+	{ "looparrowright;", "\xe2\x86\xac" },
+	{ "lscr;", "\xf0\x9d\x93\x81" },
+	{ "qopf;", "\xf0\x9d\x95\xa2" },
+	{ "varr;", "\xe2\x86\x95" },
+	{ "lotimes;", "\xe2\xa8\xb4" },
+	{ "Proportional;", "\xe2\x88\x9d" },
+	{ "ENG;", "\xc5\x8a" },
+	{ "boxVh;", "\xe2\x95\xab" },
+	{ "sum;", "\xe2\x88\x91" },
+	{ "vprop;", "\xe2\x88\x9d" },
+	{ "cups;", "\xe2\x88\xaa\xef\xb8\x80" },
+	{ "frac25;", "\xe2\x85\x96" },
+	{ "nsub;", "\xe2\x8a\x84" },
+	{ "uarr;", "\xe2\x86\x91" },
+	{ "rppolint;", "\xe2\xa8\x92" },
+	{ "deg;", "\xc2\xb0" },
+	{ "swnwar;", "\xe2\xa4\xaa" },
+	{ "ContourIntegral;", "\xe2\x88\xae" },
+	{ "rang;", "\xe2\x9f\xa9" },
+	{ "Igrave", "\xc3\x8c" },
+	{ "ssmile;", "\xe2\x8c\xa3" },
+	{ "incare;", "\xe2\x84\x85" },
+	{ "gnE;", "\xe2\x89\xa9" },
+	{ "trisb;", "\xe2\xa7\x8d" },
+	{ "cwconint;", "\xe2\x88\xb2" },
+	{ "Bfr;", "\xf0\x9d\x94\x85" },
+	{ "scap;", "\xe2\xaa\xb8" },
+	{ "tbrk;", "\xe2\x8e\xb4" },
+	{ "colon;", "\x3a" },
+	{ "nge;", "\xe2\x89\xb1" },
+	{ "rbrkslu;", "\xe2\xa6\x90" },
+	{ "imagline;", "\xe2\x84\x90" },
+	{ "star;", "\xe2\x98\x86" },
+	{ "NotSucceedsSlantEqual;", "\xe2\x8b\xa1" },
+	{ "ccedil", "\xc3\xa7" },
+	{ "primes;", "\xe2\x84\x99" },
+	{ "ltrif;", "\xe2\x97\x82" },
+	{ "RightTee;", "\xe2\x8a\xa2" },
+	{ "IEcy;", "\xd0\x95" },
+	{ "OverParenthesis;", "\xe2\x8f\x9c" },
+	{ "Kscr;", "\xf0\x9d\x92\xa6" },
+	{ "bscr;", "\xf0\x9d\x92\xb7" },
+	{ "ReverseUpEquilibrium;", "\xe2\xa5\xaf" },
+	{ "VerticalBar;", "\xe2\x88\xa3" },
+	{ "ni;", "\xe2\x88\x8b" },
+	{ "ropar;", "\xe2\xa6\x86" },
+	{ "hoarr;", "\xe2\x87\xbf" },
+	{ "llcorner;", "\xe2\x8c\x9e" },
+	{ "Implies;", "\xe2\x87\x92" },
+	{ "rangd;", "\xe2\xa6\x92" },
+	{ "simeq;", "\xe2\x89\x83" },
+	{ "Vdash;", "\xe2\x8a\xa9" },
+	{ "vsubne;", "\xe2\x8a\x8a\xef\xb8\x80" },
+	{ "sqsupset;", "\xe2\x8a\x90" },
+	{ "sup1", "\xc2\xb9" },
+	{ "rho;", "\xcf\x81" },
+	{ "sect;", "\xc2\xa7" },
+	{ "Cap;", "\xe2\x8b\x92" },
+	{ "urcorner;", "\xe2\x8c\x9d" },
+	{ "pluse;", "\xe2\xa9\xb2" },
+	{ "dfisht;", "\xe2\xa5\xbf" },
+	{ "SquareIntersection;", "\xe2\x8a\x93" },
+	{ "DiacriticalDoubleAcute;", "\xcb\x9d" },
+	{ "kappa;", "\xce\xba" },
+	{ "AElig;", "\xc3\x86" },
+	{ "div;", "\xc3\xb7" },
+	{ "rbrack;", "\x5d" },
+	{ "utilde;", "\xc5\xa9" },
+	{ "le;", "\xe2\x89\xa4" },
+	{ "SHCHcy;", "\xd0\xa9" },
+	{ "wfr;", "\xf0\x9d\x94\xb4" },
+	{ "eth;", "\xc3\xb0" },
+	{ "fflig;", "\xef\xac\x80" },
+	{ "curlywedge;", "\xe2\x8b\x8f" },
+	{ "yicy;", "\xd1\x97" },
+	{ "cirfnint;", "\xe2\xa8\x90" },
+	{ "boxH;", "\xe2\x95\x90" },
+	{ "nesear;", "\xe2\xa4\xa8" },
+	{ "Iacute", "\xc3\x8d" },
+	{ "csupe;", "\xe2\xab\x92" },
+	{ "PrecedesTilde;", "\xe2\x89\xbe" },
+	{ "langd;", "\xe2\xa6\x91" },
+	{ "subsetneq;", "\xe2\x8a\x8a" },
+	{ "nsubseteqq;", "\xe2\xab\x85\xcc\xb8" },
+	{ "YAcy;", "\xd0\xaf" },
+	{ "NotLeftTriangle;", "\xe2\x8b\xaa" },
+	{ "ngeqq;", "\xe2\x89\xa7\xcc\xb8" },
+	{ "Kappa;", "\xce\x9a" },
+	{ "copy", "\xc2\xa9" },
+	{ "RightVectorBar;", "\xe2\xa5\x93" },
+	{ "fllig;", "\xef\xac\x82" },
+	{ "lagran;", "\xe2\x84\x92" },
+	{ "Ofr;", "\xf0\x9d\x94\x92" },
+	{ "lHar;", "\xe2\xa5\xa2" },
+	{ "njcy;", "\xd1\x9a" },
+	{ "Aacute", "\xc3\x81" },
+	{ "shortparallel;", "\xe2\x88\xa5" },
+	{ "ZeroWidthSpace;", "\xe2\x80\x8b" },
+	{ "tritime;", "\xe2\xa8\xbb" },
+	{ "therefore;", "\xe2\x88\xb4" },
+	{ "nsmid;", "\xe2\x88\xa4" },
+	{ "phone;", "\xe2\x98\x8e" },
+	{ "VDash;", "\xe2\x8a\xab" },
+	{ "colone;", "\xe2\x89\x94" },
+	{ "iexcl", "\xc2\xa1" },
+	{ "Ecirc", "\xc3\x8a" },
+	{ "nvlt;", "\x3c\xe2\x83\x92" },
+	{ "Superset;", "\xe2\x8a\x83" },
+	{ "Ubrcy;", "\xd0\x8e" },
+	{ "minusdu;", "\xe2\xa8\xaa" },
+	{ "backprime;", "\xe2\x80\xb5" },
+	{ "semi;", "\x3b" },
+	{ "dlcorn;", "\xe2\x8c\x9e" },
+	{ "DoubleUpDownArrow;", "\xe2\x87\x95" },
+	{ "dblac;", "\xcb\x9d" },
+	{ "CapitalDifferentialD;", "\xe2\x85\x85" },
+	{ "gt;", "\x3e" },
+	{ "ocir;", "\xe2\x8a\x9a" },
+	{ "sup2", "\xc2\xb2" },
+	{ "seArr;", "\xe2\x87\x98" },
+	{ "RightArrowLeftArrow;", "\xe2\x87\x84" },
+	{ "larrb;", "\xe2\x87\xa4" },
+	{ "nvinfin;", "\xe2\xa7\x9e" },
+	{ "zwj;", "\xe2\x80\x8d" },
+	{ "lrhar;", "\xe2\x87\x8b" },
+	{ "ldquor;", "\xe2\x80\x9e" },
+	{ "Not;", "\xe2\xab\xac" },
+	{ "homtht;", "\xe2\x88\xbb" },
+	{ "Zscr;", "\xf0\x9d\x92\xb5" },
+	{ "Yacute;", "\xc3\x9d" },
+	{ "NotLessLess;", "\xe2\x89\xaa\xcc\xb8" },
+	{ "GreaterEqualLess;", "\xe2\x8b\x9b" },
+	{ "otimes;", "\xe2\x8a\x97" },
+	{ "DScy;", "\xd0\x85" },
+	{ "ldrdhar;", "\xe2\xa5\xa7" },
+	{ "eplus;", "\xe2\xa9\xb1" },
+	{ "lescc;", "\xe2\xaa\xa8" },
+	{ "angsph;", "\xe2\x88\xa2" },
+	{ "CircleDot;", "\xe2\x8a\x99" },
+	{ "UnderBracket;", "\xe2\x8e\xb5" },
+	{ "dscy;", "\xd1\x95" },
+	{ "VerticalSeparator;", "\xe2\x9d\x98" },
+	{ "Ouml", "\xc3\x96" },
+	{ "angle;", "\xe2\x88\xa0" },
+	{ "rarrtl;", "\xe2\x86\xa3" },
+	{ "rsh;", "\xe2\x86\xb1" },
+	{ "dharr;", "\xe2\x87\x82" },
+	{ "ulcrop;", "\xe2\x8c\x8f" },
+	{ "boxHu;", "\xe2\x95\xa7" },
+	{ "trie;", "\xe2\x89\x9c" },
+	{ "pi;", "\xcf\x80" },
+	{ "CHcy;", "\xd0\xa7" },
+	{ "Tcaron;", "\xc5\xa4" },
+	{ "RuleDelayed;", "\xe2\xa7\xb4" },
+	{ "leftrightarrows;", "\xe2\x87\x86" },
+	{ "otilde;", "\xc3\xb5" },
+	{ "SquareSubsetEqual;", "\xe2\x8a\x91" },
+	{ "af;", "\xe2\x81\xa1" },
+	{ "vnsup;", "\xe2\x8a\x83\xe2\x83\x92" },
+	{ "Omega;", "\xce\xa9" },
+	{ "prcue;", "\xe2\x89\xbc" },
+	{ "downdownarrows;", "\xe2\x87\x8a" },
+	{ "eth", "\xc3\xb0" },
+	{ "geq;", "\xe2\x89\xa5" },
+	{ "nu;", "\xce\xbd" },
+	{ "nprcue;", "\xe2\x8b\xa0" },
+	{ "DotEqual;", "\xe2\x89\x90" },
+	{ "srarr;", "\xe2\x86\x92" },
+	{ "Xopf;", "\xf0\x9d\x95\x8f" },
+	{ "rightleftharpoons;", "\xe2\x87\x8c" },
+	{ "ac;", "\xe2\x88\xbe" },
+	{ "ecirc", "\xc3\xaa" },
+	{ "Uacute", "\xc3\x9a" },
+	{ "Ucirc;", "\xc3\x9b" },
+	{ "intercal;", "\xe2\x8a\xba" },
+	{ "elsdot;", "\xe2\xaa\x97" },
+	{ "sfr;", "\xf0\x9d\x94\xb0" },
+	{ "prod;", "\xe2\x88\x8f" },
+	{ "RightArrow;", "\xe2\x86\x92" },
+	{ "notinE;", "\xe2\x8b\xb9\xcc\xb8" },
+	{ "euml", "\xc3\xab" },
+	{ "NotLeftTriangleEqual;", "\xe2\x8b\xac" },
+	{ "rdquor;", "\xe2\x80\x9d" },
+	{ "lrcorner;", "\xe2\x8c\x9f" },
+	{ "bnequiv;", "\xe2\x89\xa1\xe2\x83\xa5" },
+	{ "tcedil;", "\xc5\xa3" },
+	{ "nearrow;", "\xe2\x86\x97" },
+	{ "leftarrow;", "\xe2\x86\x90" },
+	{ "gap;", "\xe2\xaa\x86" },
+	{ "marker;", "\xe2\x96\xae" },
+	{ "Umacr;", "\xc5\xaa" },
+	{ "laquo;", "\xc2\xab" },
+	{ "Atilde", "\xc3\x83" },
+	{ "Gcirc;", "\xc4\x9c" },
+	{ "complement;", "\xe2\x88\x81" },
+	{ "Edot;", "\xc4\x96" },
+	{ "Ntilde;", "\xc3\x91" },
+	{ "lg;", "\xe2\x89\xb6" },
+	{ "LeftRightVector;", "\xe2\xa5\x8e" },
+	{ "varsigma;", "\xcf\x82" },
+	{ "precapprox;", "\xe2\xaa\xb7" },
+	{ "hArr;", "\xe2\x87\x94" },
+	{ "uwangle;", "\xe2\xa6\xa7" },
+	{ "nRightarrow;", "\xe2\x87\x8f" },
+	{ "capcap;", "\xe2\xa9\x8b" },
+	{ "cularr;", "\xe2\x86\xb6" },
+	{ "plankv;", "\xe2\x84\x8f" },
+	{ "Kcy;", "\xd0\x9a" },
+	{ "precnsim;", "\xe2\x8b\xa8" },
+	{ "LeftCeiling;", "\xe2\x8c\x88" },
+	{ "Hopf;", "\xe2\x84\x8d" },
+	{ "sqsupe;", "\xe2\x8a\x92" },
+	{ "llhard;", "\xe2\xa5\xab" },
+	{ "pluscir;", "\xe2\xa8\xa2" },
+	{ "mapsto;", "\xe2\x86\xa6" },
+	{ "ang;", "\xe2\x88\xa0" },
+	{ "lbrace;", "\x7b" },
+	{ "vBar;", "\xe2\xab\xa8" },
+	{ "uml", "\xc2\xa8" },
+	{ "aring;", "\xc3\xa5" },
+	{ "aelig", "\xc3\xa6" },
+	{ "dtdot;", "\xe2\x8b\xb1" },
+	{ "CupCap;", "\xe2\x89\x8d" },
+	{ "nwarrow;", "\xe2\x86\x96" },
+	{ "mho;", "\xe2\x84\xa7" },
+	{ "acute", "\xc2\xb4" },
+	{ "tstrok;", "\xc5\xa7" },
+	{ "circ;", "\xcb\x86" },
+	{ "ccedil;", "\xc3\xa7" },
+	{ "gesles;", "\xe2\xaa\x94" },
+	{ "nsupseteq;", "\xe2\x8a\x89" },
+	{ "oror;", "\xe2\xa9\x96" },
+	{ "lvnE;", "\xe2\x89\xa8\xef\xb8\x80" },
+	{ "yen;", "\xc2\xa5" },
+	{ "late;", "\xe2\xaa\xad" },
+	{ "Icy;", "\xd0\x98" },
+	{ "Amacr;", "\xc4\x80" },
+	{ "ldquo;", "\xe2\x80\x9c" },
+	{ "NonBreakingSpace;", "\xc2\xa0" },
+	{ "DoubleLeftArrow;", "\xe2\x87\x90" },
+	{ "cent;", "\xc2\xa2" },
+	{ "dcy;", "\xd0\xb4" },
+	{ "epsilon;", "\xce\xb5" },
+	{ "bcy;", "\xd0\xb1" },
+	{ "angmsdah;", "\xe2\xa6\xaf" },
+	{ "sup3", "\xc2\xb3" },
+	{ "lt;", "\x3c" },
+	{ "zopf;", "\xf0\x9d\x95\xab" },
+	{ "imof;", "\xe2\x8a\xb7" },
+	{ "boxdR;", "\xe2\x95\x92" },
+	{ "LessTilde;", "\xe2\x89\xb2" },
+	{ "rect;", "\xe2\x96\xad" },
+	{ "nsupE;", "\xe2\xab\x86\xcc\xb8" },
+	{ "succ;", "\xe2\x89\xbb" },
+	{ "wedbar;", "\xe2\xa9\x9f" },
+	{ "prnE;", "\xe2\xaa\xb5" },
+	{ "Fopf;", "\xf0\x9d\x94\xbd" },
+	{ "timesd;", "\xe2\xa8\xb0" },
+	{ "equivDD;", "\xe2\xa9\xb8" },
+	{ "ratio;", "\xe2\x88\xb6" },
+	{ "reg", "\xc2\xae" },
+	{ "ogt;", "\xe2\xa7\x81" },
+	{ "ofr;", "\xf0\x9d\x94\xac" },
+	{ "LeftVectorBar;", "\xe2\xa5\x92" },
+	{ "solb;", "\xe2\xa7\x84" },
+	{ "harrw;", "\xe2\x86\xad" },
+	{ "Ll;", "\xe2\x8b\x98" },
+	{ "loz;", "\xe2\x97\x8a" },
+	{ "DifferentialD;", "\xe2\x85\x86" },
+	{ "longleftrightarrow;", "\xe2\x9f\xb7" },
+	{ "para", "\xc2\xb6" },
+	{ "zhcy;", "\xd0\xb6" },
+	{ "isindot;", "\xe2\x8b\xb5" },
+	{ "AMP;", "\x26" },
+	{ "ugrave", "\xc3\xb9" },
+	{ "nparallel;", "\xe2\x88\xa6" },
+	{ "DoubleLeftTee;", "\xe2\xab\xa4" },
+	{ "boxVr;", "\xe2\x95\x9f" },
+	{ "jscr;", "\xf0\x9d\x92\xbf" },
+	{ "efr;", "\xf0\x9d\x94\xa2" },
+	{ "uhblk;", "\xe2\x96\x80" },
+	{ "CloseCurlyDoubleQuote;", "\xe2\x80\x9d" },
+	{ "dashv;", "\xe2\x8a\xa3" },
+	{ "gesdotol;", "\xe2\xaa\x84" },
+	{ "eqsim;", "\xe2\x89\x82" },
+	{ "gvnE;", "\xe2\x89\xa9\xef\xb8\x80" },
+	{ "supdot;", "\xe2\xaa\xbe" },
+	{ "curlyeqsucc;", "\xe2\x8b\x9f" },
+	{ "target;", "\xe2\x8c\x96" },
+	{ "drbkarow;", "\xe2\xa4\x90" },
+	{ "part;", "\xe2\x88\x82" },
+	{ "vfr;", "\xf0\x9d\x94\xb3" },
+	{ "macr", "\xc2\xaf" },
+	{ "napE;", "\xe2\xa9\xb0\xcc\xb8" },
+	{ "Nscr;", "\xf0\x9d\x92\xa9" },
+	{ "vartriangleleft;", "\xe2\x8a\xb2" },
+	{ "nlE;", "\xe2\x89\xa6\xcc\xb8" },
+	{ "Mellintrf;", "\xe2\x84\xb3" },
+	{ "loplus;", "\xe2\xa8\xad" },
+	{ "angzarr;", "\xe2\x8d\xbc" },
+	{ "urtri;", "\xe2\x97\xb9" },
+	{ "midcir;", "\xe2\xab\xb0" },
+	{ "circledcirc;", "\xe2\x8a\x9a" },
+	{ "Ograve;", "\xc3\x92" },
+	{ "boxdl;", "\xe2\x94\x90" },
+	{ "dscr;", "\xf0\x9d\x92\xb9" },
+	{ "there4;", "\xe2\x88\xb4" },
+	{ "jopf;", "\xf0\x9d\x95\x9b" },
+	{ "ntriangleright;", "\xe2\x8b\xab" },
+	{ "ntilde", "\xc3\xb1" },
+	{ "iexcl;", "\xc2\xa1" },
+	{ "barwed;", "\xe2\x8c\x85" },
+	{ "Sub;", "\xe2\x8b\x90" },
+	{ "thicksim;", "\xe2\x88\xbc" },
+	{ "rdquo;", "\xe2\x80\x9d" },
+	{ "Lang;", "\xe2\x9f\xaa" },
+	{ "simg;", "\xe2\xaa\x9e" },
+	{ "frac14", "\xc2\xbc" },
+	{ "NotSucceeds;", "\xe2\x8a\x81" },
+	{ "tfr;", "\xf0\x9d\x94\xb1" },
+	{ "boxVl;", "\xe2\x95\xa2" },
+	{ "eqcirc;", "\xe2\x89\x96" },
+	{ "lobrk;", "\xe2\x9f\xa6" },
+	{ "Uuml;", "\xc3\x9c" },
+	{ "NotLess;", "\xe2\x89\xae" },
+	{ "lrarr;", "\xe2\x87\x86" },
+	{ "Equilibrium;", "\xe2\x87\x8c" },
+	{ "nacute;", "\xc5\x84" },
+	{ "Wopf;", "\xf0\x9d\x95\x8e" },
+	{ "filig;", "\xef\xac\x81" },
+	{ "nsim;", "\xe2\x89\x81" },
+	{ "OverBar;", "\xe2\x80\xbe" },
+	{ "nwArr;", "\xe2\x87\x96" },
+	{ "varsubsetneqq;", "\xe2\xab\x8b\xef\xb8\x80" },
+	{ "doteqdot;", "\xe2\x89\x91" },
+	{ "Hfr;", "\xe2\x84\x8c" },
+	{ "lmoustache;", "\xe2\x8e\xb0" },
+	{ "suphsol;", "\xe2\x9f\x89" },
+	{ "angrtvbd;", "\xe2\xa6\x9d" },
+	{ "QUOT;", "\x22" },
+	{ "lbrack;", "\x5b" },
+	{ "nprec;", "\xe2\x8a\x80" },
+	{ "ThickSpace;", "\xe2\x81\x9f\xe2\x80\x8a" },
+	{ "succnapprox;", "\xe2\xaa\xba" },
+	{ "Ucy;", "\xd0\xa3" },
+	{ "ouml;", "\xc3\xb6" },
+	{ "trpezium;", "\xe2\x8f\xa2" },
+	{ "lates;", "\xe2\xaa\xad\xef\xb8\x80" },
+	{ "yopf;", "\xf0\x9d\x95\xaa" },
+	{ "subsub;", "\xe2\xab\x95" },
+	{ "Proportion;", "\xe2\x88\xb7" },
+	{ "loarr;", "\xe2\x87\xbd" },
+	{ "tscr;", "\xf0\x9d\x93\x89" },
+	{ "Mcy;", "\xd0\x9c" },
+	{ "PartialD;", "\xe2\x88\x82" },
+	{ "jmath;", "\xc8\xb7" },
+	{ "napid;", "\xe2\x89\x8b\xcc\xb8" },
+	{ "frac12;", "\xc2\xbd" },
+	{ "Vopf;", "\xf0\x9d\x95\x8d" },
+	{ "nvHarr;", "\xe2\xa4\x84" },
+	{ "rsaquo;", "\xe2\x80\xba" },
+	{ "xmap;", "\xe2\x9f\xbc" },
+	{ "phmmat;", "\xe2\x84\xb3" },
+	{ "NotSquareSubsetEqual;", "\xe2\x8b\xa2" },
+	{ "pm;", "\xc2\xb1" },
+	{ "nLtv;", "\xe2\x89\xaa\xcc\xb8" },
+	{ "supedot;", "\xe2\xab\x84" },
+	{ "upsilon;", "\xcf\x85" },
+	{ "smeparsl;", "\xe2\xa7\xa4" },
+	{ "theta;", "\xce\xb8" },
+	{ "timesb;", "\xe2\x8a\xa0" },
+	{ "Leftarrow;", "\xe2\x87\x90" },
+	{ "ssetmn;", "\xe2\x88\x96" },
+	{ "AElig", "\xc3\x86" },
+	{ "Barv;", "\xe2\xab\xa7" },
+	{ "harrcir;", "\xe2\xa5\x88" },
+	{ "Or;", "\xe2\xa9\x94" },
+	{ "lat;", "\xe2\xaa\xab" },
+	{ "NotNestedGreaterGreater;", "\xe2\xaa\xa2\xcc\xb8" },
+	{ "diams;", "\xe2\x99\xa6" },
+	{ "Prime;", "\xe2\x80\xb3" },
+	{ "kjcy;", "\xd1\x9c" },
+	{ "afr;", "\xf0\x9d\x94\x9e" },
+	{ "simplus;", "\xe2\xa8\xa4" },
+	{ "brvbar", "\xc2\xa6" },
+	{ "hellip;", "\xe2\x80\xa6" },
+	{ "emptyv;", "\xe2\x88\x85" },
+	{ "TScy;", "\xd0\xa6" },
+	{ "iprod;", "\xe2\xa8\xbc" },
+	{ "NestedGreaterGreater;", "\xe2\x89\xab" },
+	{ "ges;", "\xe2\xa9\xbe" },
+	{ "glE;", "\xe2\xaa\x92" },
+	{ "nsupseteqq;", "\xe2\xab\x86\xcc\xb8" },
+	{ "mapstoup;", "\xe2\x86\xa5" },
+	{ "lpar;", "\x28" },
+	{ "ecaron;", "\xc4\x9b" },
+	{ "MediumSpace;", "\xe2\x81\x9f" },
+	{ "LeftDownVector;", "\xe2\x87\x83" },
+	{ "equest;", "\xe2\x89\x9f" },
+	{ "lesseqqgtr;", "\xe2\xaa\x8b" },
+	{ "lsimg;", "\xe2\xaa\x8f" },
+	{ "Gammad;", "\xcf\x9c" },
+	{ "ucirc;", "\xc3\xbb" },
+	{ "nGt;", "\xe2\x89\xab\xe2\x83\x92" },
+	{ "dash;", "\xe2\x80\x90" },
+	{ "complexes;", "\xe2\x84\x82" },
+	{ "Xi;", "\xce\x9e" },
+	{ "dotminus;", "\xe2\x88\xb8" },
+	{ "forkv;", "\xe2\xab\x99" },
+	{ "ThinSpace;", "\xe2\x80\x89" },
+	{ "Fcy;", "\xd0\xa4" },
+	{ "nscr;", "\xf0\x9d\x93\x83" },
+	{ "cudarrl;", "\xe2\xa4\xb8" },
+	{ "rfisht;", "\xe2\xa5\xbd" },
+	{ "cedil;", "\xc2\xb8" },
+	{ "frac45;", "\xe2\x85\x98" },
+	{ "Ugrave", "\xc3\x99" },
+	{ "fpartint;", "\xe2\xa8\x8d" },
+	{ "Lstrok;", "\xc5\x81" },
+	{ "Uuml", "\xc3\x9c" },
+	{ "dsol;", "\xe2\xa7\xb6" },
+	{ "boxdr;", "\xe2\x94\x8c" },
+	{ "Oacute;", "\xc3\x93" },
+	{ "circlearrowright;", "\xe2\x86\xbb" },
+	{ "xnis;", "\xe2\x8b\xbb" },
+	{ "Zfr;", "\xe2\x84\xa8" },
+	{ "Emacr;", "\xc4\x92" },
+	{ "ljcy;", "\xd1\x99" },
+	{ "Zacute;", "\xc5\xb9" },
+	{ "eta;", "\xce\xb7" },
+	{ "LongLeftRightArrow;", "\xe2\x9f\xb7" },
+	{ "nwarhk;", "\xe2\xa4\xa3" },
+	{ "mopf;", "\xf0\x9d\x95\x9e" },
+	{ "cwint;", "\xe2\x88\xb1" },
+	{ "tprime;", "\xe2\x80\xb4" },
+	{ "micro;", "\xc2\xb5" },
+	{ "plussim;", "\xe2\xa8\xa6" },
+	{ "oS;", "\xe2\x93\x88" },
+	{ "scpolint;", "\xe2\xa8\x93" },
+	{ "Iukcy;", "\xd0\x86" },
+	{ "nrightarrow;", "\xe2\x86\x9b" },
+	{ "bsemi;", "\xe2\x81\x8f" },
+	{ "beta;", "\xce\xb2" },
+	{ "planck;", "\xe2\x84\x8f" },
+	{ "leftrightsquigarrow;", "\xe2\x86\xad" },
+	{ "triangledown;", "\xe2\x96\xbf" },
+	{ "nvDash;", "\xe2\x8a\xad" },
+	{ "rightsquigarrow;", "\xe2\x86\x9d" },
+	{ "lcub;", "\x7b" },
+	{ "boxvl;", "\xe2\x94\xa4" },
+	{ "equiv;", "\xe2\x89\xa1" },
+	{ "supnE;", "\xe2\xab\x8c" },
+	{ "GreaterTilde;", "\xe2\x89\xb3" },
+	{ "rHar;", "\xe2\xa5\xa4" },
+	{ "Bscr;", "\xe2\x84\xac" },
+	{ "LeftDownTeeVector;", "\xe2\xa5\xa1" },
+	{ "EqualTilde;", "\xe2\x89\x82" },
+	{ "udhar;", "\xe2\xa5\xae" },
+	{ "lesdotor;", "\xe2\xaa\x83" },
+	{ "agrave", "\xc3\xa0" },
+	{ "lfr;", "\xf0\x9d\x94\xa9" },
+	{ "rarrhk;", "\xe2\x86\xaa" },
+	{ "Atilde;", "\xc3\x83" },
+	{ "NotNestedLessLess;", "\xe2\xaa\xa1\xcc\xb8" },
+	{ "iiint;", "\xe2\x88\xad" },
+	{ "caron;", "\xcb\x87" },
+	{ "Cayleys;", "\xe2\x84\xad" },
+	{ "NotEqualTilde;", "\xe2\x89\x82\xcc\xb8" },
+	{ "capbrcup;", "\xe2\xa9\x89" },
+	{ "sqcap;", "\xe2\x8a\x93" },
+	{ "eDDot;", "\xe2\xa9\xb7" },
+	{ "nopf;", "\xf0\x9d\x95\x9f" },
+	{ "racute;", "\xc5\x95" },
+	{ "rlm;", "\xe2\x80\x8f" },
+	{ "simdot;", "\xe2\xa9\xaa" },
+	{ "sacute;", "\xc5\x9b" },
+	{ "lfisht;", "\xe2\xa5\xbc" },
+	{ "ZHcy;", "\xd0\x96" },
+	{ "frac13;", "\xe2\x85\x93" },
+	{ "rightharpoonup;", "\xe2\x87\x80" },
+	{ "Scy;", "\xd0\xa1" },
+	{ "kcedil;", "\xc4\xb7" },
+	{ "VeryThinSpace;", "\xe2\x80\x8a" },
+	{ "backsimeq;", "\xe2\x8b\x8d" },
+	{ "SmallCircle;", "\xe2\x88\x98" },
+	{ "yfr;", "\xf0\x9d\x94\xb6" },
+	{ "gne;", "\xe2\xaa\x88" },
+	{ "clubsuit;", "\xe2\x99\xa3" },
+	{ "NotSupersetEqual;", "\xe2\x8a\x89" },
+	{ "Aacute;", "\xc3\x81" },
+	{ "ddagger;", "\xe2\x80\xa1" },
+	{ "acirc", "\xc3\xa2" },
+	{ "topf;", "\xf0\x9d\x95\xa5" },
+	{ "LeftUpVector;", "\xe2\x86\xbf" },
+	{ "Delta;", "\xce\x94" },
+	{ "sup;", "\xe2\x8a\x83" },
+	{ "rarrb;", "\xe2\x87\xa5" },
+	{ "SOFTcy;", "\xd0\xac" },
+	{ "cong;", "\xe2\x89\x85" },
+	{ "NotDoubleVerticalBar;", "\xe2\x88\xa6" },
+	{ "supset;", "\xe2\x8a\x83" },
+	{ "Sfr;", "\xf0\x9d\x94\x96" },
+	{ "ncap;", "\xe2\xa9\x83" },
+	{ "imacr;", "\xc4\xab" },
+	{ "gtquest;", "\xe2\xa9\xbc" },
+	{ "permil;", "\xe2\x80\xb0" },
+	{ "UpTeeArrow;", "\xe2\x86\xa5" },
+	{ "acirc;", "\xc3\xa2" },
+	{ "FilledVerySmallSquare;", "\xe2\x96\xaa" },
+	{ "sext;", "\xe2\x9c\xb6" },
+	{ "ncong;", "\xe2\x89\x87" },
+	{ "Fouriertrf;", "\xe2\x84\xb1" },
+	{ "notinvb;", "\xe2\x8b\xb7" },
+	{ "quest;", "\x3f" },
+	{ "ulcorner;", "\xe2\x8c\x9c" },
+	{ "reals;", "\xe2\x84\x9d" },
+	{ "check;", "\xe2\x9c\x93" },
+	{ "notnivb;", "\xe2\x8b\xbe" },
+	{ "ccups;", "\xe2\xa9\x8c" },
+	{ "rfr;", "\xf0\x9d\x94\xaf" },
+	{ "hyphen;", "\xe2\x80\x90" },
+	{ "nwarr;", "\xe2\x86\x96" },
+	{ "boxhU;", "\xe2\x95\xa8" },
+	{ "smt;", "\xe2\xaa\xaa" },
+	{ "subdot;", "\xe2\xaa\xbd" },
+	{ "Sscr;", "\xf0\x9d\x92\xae" },
+	{ "sigmaf;", "\xcf\x82" },
+	{ "DownArrowBar;", "\xe2\xa4\x93" },
+	{ "eDot;", "\xe2\x89\x91" },
+	{ "Int;", "\xe2\x88\xac" },
+	{ "parallel;", "\xe2\x88\xa5" },
+	{ "isinv;", "\xe2\x88\x88" },
+	{ "boxHd;", "\xe2\x95\xa4" },
+	{ "circledS;", "\xe2\x93\x88" },
+	{ "sqsubseteq;", "\xe2\x8a\x91" },
+	{ "olt;", "\xe2\xa7\x80" },
+	{ "rotimes;", "\xe2\xa8\xb5" },
+	{ "female;", "\xe2\x99\x80" },
+	{ "npart;", "\xe2\x88\x82\xcc\xb8" },
+	{ "apos;", "\x27" },
+	{ "ropf;", "\xf0\x9d\x95\xa3" },
+	{ "rarrc;", "\xe2\xa4\xb3" },
+	{ "NotTildeFullEqual;", "\xe2\x89\x87" },
+	{ "bsol;", "\x5c" },
+	{ "LessSlantEqual;", "\xe2\xa9\xbd" },
+	{ "DoubleDownArrow;", "\xe2\x87\x93" },
+	{ "searrow;", "\xe2\x86\x98" },
+	{ "Aogon;", "\xc4\x84" },
+	{ "Tab;", "\x09" },
+	{ "amp;", "\x26" },
+	{ "hearts;", "\xe2\x99\xa5" },
+	{ "edot;", "\xc4\x97" },
+	{ "sharp;", "\xe2\x99\xaf" },
+	{ "para;", "\xc2\xb6" },
+	{ "Bumpeq;", "\xe2\x89\x8e" },
+	{ "notnivc;", "\xe2\x8b\xbd" },
+	{ "Integral;", "\xe2\x88\xab" },
+	{ "dd;", "\xe2\x85\x86" },
+	{ "larrhk;", "\xe2\x86\xa9" },
+	{ "IOcy;", "\xd0\x81" },
+	{ "angmsdae;", "\xe2\xa6\xac" },
+	{ "lthree;", "\xe2\x8b\x8b" },
+	{ "opar;", "\xe2\xa6\xb7" },
+	{ "pscr;", "\xf0\x9d\x93\x85" },
+	{ "Bcy;", "\xd0\x91" },
+	{ "exist;", "\xe2\x88\x83" },
+	{ "Uogon;", "\xc5\xb2" },
+	{ "twoheadleftarrow;", "\xe2\x86\x9e" },
+	{ "Barwed;", "\xe2\x8c\x86" },
+	{ "uharl;", "\xe2\x86\xbf" },
+	{ "Gcedil;", "\xc4\xa2" },
+	{ "bull;", "\xe2\x80\xa2" },
+	{ "vert;", "\x7c" },
+	{ "Ccedil;", "\xc3\x87" },
+	{ "oacute", "\xc3\xb3" },
+	{ "Scirc;", "\xc5\x9c" },
+	{ "triangle;", "\xe2\x96\xb5" },
+	{ "agrave;", "\xc3\xa0" },
+	{ "euml;", "\xc3\xab" },
+	{ "MinusPlus;", "\xe2\x88\x93" },
+	{ "thickapprox;", "\xe2\x89\x88" },
+	{ "looparrowleft;", "\xe2\x86\xab" },
+	{ "Longleftrightarrow;", "\xe2\x9f\xba" },
+	{ "Element;", "\xe2\x88\x88" },
+	{ "aogon;", "\xc4\x85" },
+	{ "olarr;", "\xe2\x86\xba" },
+	{ "Lacute;", "\xc4\xb9" },
+	{ "cent", "\xc2\xa2" },
+	{ "Uacute;", "\xc3\x9a" },
+	{ "YUcy;", "\xd0\xae" },
+	{ "auml", "\xc3\xa4" },
+	{ "cemptyv;", "\xe2\xa6\xb2" },
+	{ "isins;", "\xe2\x8b\xb4" },
+	{ "bepsi;", "\xcf\xb6" },
+	{ "nges;", "\xe2\xa9\xbe\xcc\xb8" },
+	{ "Nacute;", "\xc5\x83" },
+	{ "Vbar;", "\xe2\xab\xab" },
+	{ "sup2;", "\xc2\xb2" },
+	{ "ncy;", "\xd0\xbd" },
+	{ "supseteq;", "\xe2\x8a\x87" },
+	{ "DoubleLongLeftArrow;", "\xe2\x9f\xb8" },
+	{ "vdash;", "\xe2\x8a\xa2" },
+	{ "shy", "\xc2\xad" },
+	{ "varnothing;", "\xe2\x88\x85" },
+	{ "Poincareplane;", "\xe2\x84\x8c" },
+	{ "cirmid;", "\xe2\xab\xaf" },
+	{ "vnsub;", "\xe2\x8a\x82\xe2\x83\x92" },
+	{ "DownLeftVector;", "\xe2\x86\xbd" },
+	{ "gtcir;", "\xe2\xa9\xba" },
+	{ "simrarr;", "\xe2\xa5\xb2" },
+	{ "scnap;", "\xe2\xaa\xba" },
+	{ "nleftrightarrow;", "\xe2\x86\xae" },
+	{ "uuml;", "\xc3\xbc" },
+	{ "icirc;", "\xc3\xae" },
+	{ "DiacriticalTilde;", "\xcb\x9c" },
+	{ "Vvdash;", "\xe2\x8a\xaa" },
+	{ "notindot;", "\xe2\x8b\xb5\xcc\xb8" },
+	{ "cirscir;", "\xe2\xa7\x82" },
+	{ "triplus;", "\xe2\xa8\xb9" },
+	{ "rfloor;", "\xe2\x8c\x8b" },
+	{ "amacr;", "\xc4\x81" },
+	{ "cupcup;", "\xe2\xa9\x8a" },
+	{ "apacir;", "\xe2\xa9\xaf" },
+	{ "omacr;", "\xc5\x8d" },
+	{ "ocy;", "\xd0\xbe" },
+	{ "xrarr;", "\xe2\x9f\xb6" },
+	{ "apE;", "\xe2\xa9\xb0" },
+	{ "vscr;", "\xf0\x9d\x93\x8b" },
+	{ "squf;", "\xe2\x96\xaa" },
+	{ "rarr;", "\xe2\x86\x92" },
+	{ "zcy;", "\xd0\xb7" },
+	{ "orv;", "\xe2\xa9\x9b" },
+	{ "Zcy;", "\xd0\x97" },
+	{ "UnderBrace;", "\xe2\x8f\x9f" },
+	{ "lnE;", "\xe2\x89\xa8" },
+	{ "timesbar;", "\xe2\xa8\xb1" },
+	{ "imagpart;", "\xe2\x84\x91" },
+	{ "Zopf;", "\xe2\x84\xa4" },
+	{ "Ycirc;", "\xc5\xb6" },
+	{ "num;", "\x23" },
+	{ "NotTildeTilde;", "\xe2\x89\x89" },
+	{ "updownarrow;", "\xe2\x86\x95" },
+	{ "ic;", "\xe2\x81\xa3" },
+	{ "hfr;", "\xf0\x9d\x94\xa5" },
+	{ "lAarr;", "\xe2\x87\x9a" },
+	{ "Icirc", "\xc3\x8e" },
+	{ "NotPrecedesEqual;", "\xe2\xaa\xaf\xcc\xb8" },
+	{ "imped;", "\xc6\xb5" },
+	{ "ReverseElement;", "\xe2\x88\x8b" },
+	{ "lceil;", "\xe2\x8c\x88" },
+	{ "frac78;", "\xe2\x85\x9e" },
+	{ "subne;", "\xe2\x8a\x8a" },
+	{ "Lscr;", "\xe2\x84\x92" },
+	{ "smid;", "\xe2\x88\xa3" },
+	{ "npre;", "\xe2\xaa\xaf\xcc\xb8" },
+	{ "ccaps;", "\xe2\xa9\x8d" },
+	{ "Map;", "\xe2\xa4\x85" },
+	{ "egrave;", "\xc3\xa8" },
+	{ "lbrke;", "\xe2\xa6\x8b" },
+	{ "maltese;", "\xe2\x9c\xa0" },
+	{ "lowast;", "\xe2\x88\x97" },
+	{ "ncaron;", "\xc5\x88" },
+	{ "NotCongruent;", "\xe2\x89\xa2" },
+	{ "nvrtrie;", "\xe2\x8a\xb5\xe2\x83\x92" },
+	{ "gtrapprox;", "\xe2\xaa\x86" },
+	{ "DoubleDot;", "\xc2\xa8" },
+	{ "scaron;", "\xc5\xa1" },
+	{ "thkap;", "\xe2\x89\x88" },
+	{ "Rrightarrow;", "\xe2\x87\x9b" },
+	{ "easter;", "\xe2\xa9\xae" },
+	{ "UpArrow;", "\xe2\x86\x91" },
+	{ "cir;", "\xe2\x97\x8b" },
+	{ "gesl;", "\xe2\x8b\x9b\xef\xb8\x80" },
+	{ "nvap;", "\xe2\x89\x8d\xe2\x83\x92" },
+	{ "divonx;", "\xe2\x8b\x87" },
+	{ "lessdot;", "\xe2\x8b\x96" },
+	{ "infintie;", "\xe2\xa7\x9d" },
+	{ "Otilde;", "\xc3\x95" },
+	{ "gE;", "\xe2\x89\xa7" },
+	{ "xotime;", "\xe2\xa8\x82" },
+	{ "UpArrowBar;", "\xe2\xa4\x92" },
+	{ "boxvH;", "\xe2\x95\xaa" },
+	{ "varsubsetneq;", "\xe2\x8a\x8a\xef\xb8\x80" },
+	{ "pfr;", "\xf0\x9d\x94\xad" },
+	{ "UnionPlus;", "\xe2\x8a\x8e" },
+	{ "Ucirc", "\xc3\x9b" },
+	{ "vopf;", "\xf0\x9d\x95\xa7" },
+	{ "Gopf;", "\xf0\x9d\x94\xbe" },
+	{ "Exists;", "\xe2\x88\x83" },
+	{ "ltquest;", "\xe2\xa9\xbb" },
+	{ "rArr;", "\xe2\x87\x92" },
+	{ "Xscr;", "\xf0\x9d\x92\xb3" },
+	{ "Colone;", "\xe2\xa9\xb4" },
+	{ "ltcir;", "\xe2\xa9\xb9" },
+	{ "leftrightarrow;", "\xe2\x86\x94" },
+	{ "xcap;", "\xe2\x8b\x82" },
+	{ "softcy;", "\xd1\x8c" },
+	{ "xi;", "\xce\xbe" },
+	{ "LessGreater;", "\xe2\x89\xb6" },
+	{ "OpenCurlyQuote;", "\xe2\x80\x98" },
+	{ "Uscr;", "\xf0\x9d\x92\xb0" },
+	{ "csub;", "\xe2\xab\x8f" },
+	{ "varphi;", "\xcf\x95" },
+	{ "Chi;", "\xce\xa7" },
+	{ "spadesuit;", "\xe2\x99\xa0" },
+	{ "iquest;", "\xc2\xbf" },
+	{ "veeeq;", "\xe2\x89\x9a" },
+	{ "wcirc;", "\xc5\xb5" },
+	{ "RoundImplies;", "\xe2\xa5\xb0" },
+	{ "Ccaron;", "\xc4\x8c" },
+	{ "IJlig;", "\xc4\xb2" },
+	{ "xutri;", "\xe2\x96\xb3" },
+	{ "odblac;", "\xc5\x91" },
+	{ "lambda;", "\xce\xbb" },
+	{ "Jukcy;", "\xd0\x84" },
+	{ "ordm;", "\xc2\xba" },
+	{ "frac14;", "\xc2\xbc" },
+	{ "LeftArrowRightArrow;", "\xe2\x87\x86" },
+	{ "eng;", "\xc5\x8b" },
+	{ "oslash", "\xc3\xb8" },
+	{ "precnapprox;", "\xe2\xaa\xb9" },
+	{ "downharpoonleft;", "\xe2\x87\x83" },
+	{ "Re;", "\xe2\x84\x9c" },
+	{ "Acirc", "\xc3\x82" },
+	{ "simgE;", "\xe2\xaa\xa0" },
+	{ "mdash;", "\xe2\x80\x94" },
+	{ "subnE;", "\xe2\xab\x8b" },
+	{ "prurel;", "\xe2\x8a\xb0" },
+	{ "straightphi;", "\xcf\x95" },
+	{ "VerticalTilde;", "\xe2\x89\x80" },
+	{ "bfr;", "\xf0\x9d\x94\x9f" },
+	{ "qint;", "\xe2\xa8\x8c" },
+	{ "Gbreve;", "\xc4\x9e" },
+	{ "mcy;", "\xd0\xbc" },
+	{ "Dot;", "\xc2\xa8" },
+	{ "RightTriangle;", "\xe2\x8a\xb3" },
+	{ "blacktriangleleft;", "\xe2\x97\x82" },
+	{ "cup;", "\xe2\x88\xaa" },
+	{ "apid;", "\xe2\x89\x8b" },
+	{ "LeftTriangleEqual;", "\xe2\x8a\xb4" },
+	{ "Square;", "\xe2\x96\xa1" },
+	{ "odot;", "\xe2\x8a\x99" },
+	{ "Pcy;", "\xd0\x9f" },
+	{ "Tfr;", "\xf0\x9d\x94\x97" },
+	{ "nsccue;", "\xe2\x8b\xa1" },
+	{ "ll;", "\xe2\x89\xaa" },
+	{ "period;", "\x2e" },
+	{ "ominus;", "\xe2\x8a\x96" },
+	{ "UpTee;", "\xe2\x8a\xa5" },
+	{ "NotGreaterGreater;", "\xe2\x89\xab\xcc\xb8" },
+	{ "bullet;", "\xe2\x80\xa2" },
+	{ "dwangle;", "\xe2\xa6\xa6" },
+	{ "tscy;", "\xd1\x86" },
+	{ "Intersection;", "\xe2\x8b\x82" },
+	{ "hercon;", "\xe2\x8a\xb9" },
+	{ "dstrok;", "\xc4\x91" },
+	{ "RBarr;", "\xe2\xa4\x90" },
+	{ "ldsh;", "\xe2\x86\xb2" },
+	{ "nap;", "\xe2\x89\x89" },
+	{ "Iogon;", "\xc4\xae" },
+	{ "dArr;", "\xe2\x87\x93" },
+	{ "nrarrw;", "\xe2\x86\x9d\xcc\xb8" },
+	{ "gtrsim;", "\xe2\x89\xb3" },
+	{ "ncongdot;", "\xe2\xa9\xad\xcc\xb8" },
+	{ "image;", "\xe2\x84\x91" },
+	{ "Kopf;", "\xf0\x9d\x95\x82" },
+	{ "aopf;", "\xf0\x9d\x95\x92" },
+	{ "prop;", "\xe2\x88\x9d" },
+	{ "pr;", "\xe2\x89\xba" },
+	{ "sube;", "\xe2\x8a\x86" },
+	{ "NotRightTriangleEqual;", "\xe2\x8b\xad" },
+	{ "bigstar;", "\xe2\x98\x85" },
+	{ "subedot;", "\xe2\xab\x83" },
+	{ "cire;", "\xe2\x89\x97" },
+	{ "InvisibleComma;", "\xe2\x81\xa3" },
+	{ "copysr;", "\xe2\x84\x97" },
+	{ "Dfr;", "\xf0\x9d\x94\x87" },
+	{ "nlArr;", "\xe2\x87\x8d" },
+	{ "isinsv;", "\xe2\x8b\xb3" },
+	{ "TildeFullEqual;", "\xe2\x89\x85" },
+	{ "RightUpTeeVector;", "\xe2\xa5\x9c" },
+	{ "sstarf;", "\xe2\x8b\x86" },
+	{ "nbsp;", "\xc2\xa0" },
+	{ "succapprox;", "\xe2\xaa\xb8" },
+	{ "NotLessTilde;", "\xe2\x89\xb4" },
+	{ "mcomma;", "\xe2\xa8\xa9" },
+	{ "biguplus;", "\xe2\xa8\x84" },
+	{ "lstrok;", "\xc5\x82" },
+	{ "kgreen;", "\xc4\xb8" },
+	{ "eqslantless;", "\xe2\xaa\x95" },
+	{ "DownLeftRightVector;", "\xe2\xa5\x90" },
+	{ "caret;", "\xe2\x81\x81" },
+	{ "ddotseq;", "\xe2\xa9\xb7" },
+	{ "swArr;", "\xe2\x87\x99" },
+	{ "gbreve;", "\xc4\x9f" },
+	{ "latail;", "\xe2\xa4\x99" },
+	{ "xhArr;", "\xe2\x9f\xba" },
+	{ "Yfr;", "\xf0\x9d\x94\x9c" },
+	{ "darr;", "\xe2\x86\x93" },
+	{ "Jfr;", "\xf0\x9d\x94\x8d" },
+	{ "iukcy;", "\xd1\x96" },
+	{ "geqq;", "\xe2\x89\xa7" },
+	{ "boxplus;", "\xe2\x8a\x9e" },
+	{ "models;", "\xe2\x8a\xa7" },
+	{ "NotTilde;", "\xe2\x89\x81" },
+	{ "COPY", "\xc2\xa9" },
+	{ "spades;", "\xe2\x99\xa0" },
+	{ "minusd;", "\xe2\x88\xb8" },
+	{ "LongLeftArrow;", "\xe2\x9f\xb5" },
+	{ "lesdoto;", "\xe2\xaa\x81" },
+	{ "boxVH;", "\xe2\x95\xac" },
+	{ "uharr;", "\xe2\x86\xbe" },
+	{ "les;", "\xe2\xa9\xbd" },
+	{ "OpenCurlyDoubleQuote;", "\xe2\x80\x9c" },
+	{ "Auml", "\xc3\x84" },
+	{ "emsp;", "\xe2\x80\x83" },
+	{ "rAtail;", "\xe2\xa4\x9c" },
+	{ "malt;", "\xe2\x9c\xa0" },
+	{ "upsi;", "\xcf\x85" },
+	{ "vcy;", "\xd0\xb2" },
+	{ "bigsqcup;", "\xe2\xa8\x86" },
+	{ "frac58;", "\xe2\x85\x9d" },
+	{ "neArr;", "\xe2\x87\x97" },
+	{ "reg;", "\xc2\xae" },
+	{ "nsce;", "\xe2\xaa\xb0\xcc\xb8" },
+	{ "supplus;", "\xe2\xab\x80" },
+	{ "LJcy;", "\xd0\x89" },
+	{ "UpEquilibrium;", "\xe2\xa5\xae" },
+	{ "omid;", "\xe2\xa6\xb6" },
+	{ "SucceedsEqual;", "\xe2\xaa\xb0" },
+	{ "nvgt;", "\x3e\xe2\x83\x92" },
+	{ "ggg;", "\xe2\x8b\x99" },
+	{ "lozf;", "\xe2\xa7\xab" },
+	{ "loang;", "\xe2\x9f\xac" },
+	{ "roplus;", "\xe2\xa8\xae" },
+	{ "Cscr;", "\xf0\x9d\x92\x9e" },
+	{ "szlig", "\xc3\x9f" },
+	{ "boxDr;", "\xe2\x95\x93" },
+	{ "nvdash;", "\xe2\x8a\xac" },
+	{ "bsime;", "\xe2\x8b\x8d" },
+	{ "rcub;", "\x7d" },
+	{ "SubsetEqual;", "\xe2\x8a\x86" },
+	{ "expectation;", "\xe2\x84\xb0" },
+	{ "Eacute;", "\xc3\x89" },
+	{ "subset;", "\xe2\x8a\x82" },
+	{ "Dcaron;", "\xc4\x8e" },
+	{ "Cedilla;", "\xc2\xb8" },
+	{ "uArr;", "\xe2\x87\x91" },
+	{ "midast;", "\x2a" },
+	{ "gEl;", "\xe2\xaa\x8c" },
+	{ "rrarr;", "\xe2\x87\x89" },
+	{ "ntrianglerighteq;", "\xe2\x8b\xad" },
+	{ "Mscr;", "\xe2\x84\xb3" },
+	{ "nLeftarrow;", "\xe2\x87\x8d" },
+	{ "cirE;", "\xe2\xa7\x83" },
+	{ "frac56;", "\xe2\x85\x9a" },
+	{ "csube;", "\xe2\xab\x91" },
+	{ "frac23;", "\xe2\x85\x94" },
+	{ "ofcir;", "\xe2\xa6\xbf" },
+	{ "strns;", "\xc2\xaf" },
+	{ "lbrkslu;", "\xe2\xa6\x8d" },
+	{ "leqslant;", "\xe2\xa9\xbd" },
+	{ "icy;", "\xd0\xb8" },
+	{ "boxDl;", "\xe2\x95\x96" },
+	{ "nsqsupe;", "\xe2\x8b\xa3" },
+	{ "GreaterFullEqual;", "\xe2\x89\xa7" },
+	{ "phiv;", "\xcf\x95" },
+	{ "Jopf;", "\xf0\x9d\x95\x81" },
+	{ "pitchfork;", "\xe2\x8b\x94" },
+	{ "Sc;", "\xe2\xaa\xbc" },
+	{ "COPY;", "\xc2\xa9" },
+	{ "leq;", "\xe2\x89\xa4" },
+	{ "UpperLeftArrow;", "\xe2\x86\x96" },
+	{ "roang;", "\xe2\x9f\xad" },
+	{ "subE;", "\xe2\xab\x85" },
+	{ "curvearrowleft;", "\xe2\x86\xb6" },
+	{ "lcy;", "\xd0\xbb" },
+	{ "Omicron;", "\xce\x9f" },
+	{ "Odblac;", "\xc5\x90" },
+	{ "inodot;", "\xc4\xb1" },
+	{ "esim;", "\xe2\x89\x82" },
+	{ "varpi;", "\xcf\x96" },
+	{ "erarr;", "\xe2\xa5\xb1" },
+	{ "ffllig;", "\xef\xac\x84" },
+	{ "ETH", "\xc3\x90" },
+	{ "NotPrecedes;", "\xe2\x8a\x80" },
+	{ "hkswarow;", "\xe2\xa4\xa6" },
+	{ "RightUpDownVector;", "\xe2\xa5\x8f" },
+	{ "Oopf;", "\xf0\x9d\x95\x86" },
+	{ "nvge;", "\xe2\x89\xa5\xe2\x83\x92" },
+	{ "angmsdaa;", "\xe2\xa6\xa8" },
+	{ "ifr;", "\xf0\x9d\x94\xa6" },
+	{ "jcirc;", "\xc4\xb5" },
+	{ "xdtri;", "\xe2\x96\xbd" },
+	{ "mlcp;", "\xe2\xab\x9b" },
+	{ "divideontimes;", "\xe2\x8b\x87" },
+	{ "Wedge;", "\xe2\x8b\x80" },
+	{ "Scaron;", "\xc5\xa0" },
+	{ "swarrow;", "\xe2\x86\x99" },
+	{ "Qscr;", "\xf0\x9d\x92\xac" },
+	{ "bigwedge;", "\xe2\x8b\x80" },
+	{ "intlarhk;", "\xe2\xa8\x97" },
+	{ "profline;", "\xe2\x8c\x92" },
+	{ "esdot;", "\xe2\x89\x90" },
+	{ "eqvparsl;", "\xe2\xa7\xa5" },
+	{ "Longleftarrow;", "\xe2\x9f\xb8" },
+	{ "xcup;", "\xe2\x8b\x83" },
+	{ "Ecaron;", "\xc4\x9a" },
+	{ "urcorn;", "\xe2\x8c\x9d" },
+	{ "operp;", "\xe2\xa6\xb9" },
+	{ "gcy;", "\xd0\xb3" },
+	{ "Uarrocir;", "\xe2\xa5\x89" },
+	{ "LeftTriangleBar;", "\xe2\xa7\x8f" },
+	{ "HARDcy;", "\xd0\xaa" },
+	{ "ReverseEquilibrium;", "\xe2\x87\x8b" },
+	{ "grave;", "\x60" },
+	{ "rtimes;", "\xe2\x8b\x8a" },
+	{ "caps;", "\xe2\x88\xa9\xef\xb8\x80" },
+	{ "dharl;", "\xe2\x87\x83" },
+	{ "mp;", "\xe2\x88\x93" },
+	{ "Uopf;", "\xf0\x9d\x95\x8c" },
+	{ "deg", "\xc2\xb0" },
+	{ "rbarr;", "\xe2\xa4\x8d" },
+	{ "HumpDownHump;", "\xe2\x89\x8e" },
+	{ "cross;", "\xe2\x9c\x97" },
+	{ "aelig;", "\xc3\xa6" },
+	{ "ycy;", "\xd1\x8b" },
+	{ "Gscr;", "\xf0\x9d\x92\xa2" },
+	{ "angmsdad;", "\xe2\xa6\xab" },
+	{ "gjcy;", "\xd1\x93" },
+	{ "EmptyVerySmallSquare;", "\xe2\x96\xab" },
+	{ "uacute", "\xc3\xba" },
+	{ "forall;", "\xe2\x88\x80" },
+	{ "ldrushar;", "\xe2\xa5\x8b" },
+	{ "hamilt;", "\xe2\x84\x8b" },
+	{ "becaus;", "\xe2\x88\xb5" },
+	{ "middot;", "\xc2\xb7" },
+	{ "frown;", "\xe2\x8c\xa2" },
+	{ "ecirc;", "\xc3\xaa" },
+	{ "Oslash;", "\xc3\x98" },
+	{ "lmoust;", "\xe2\x8e\xb0" },
+	{ "Vert;", "\xe2\x80\x96" },
+	{ "Sum;", "\xe2\x88\x91" },
+	{ "xsqcup;", "\xe2\xa8\x86" },
+	{ "sdot;", "\xe2\x8b\x85" },
+	{ "rcy;", "\xd1\x80" },
+	{ "Afr;", "\xf0\x9d\x94\x84" },
+	{ "ulcorn;", "\xe2\x8c\x9c" },
+	{ "LeftVector;", "\xe2\x86\xbc" },
+	{ "utrif;", "\xe2\x96\xb4" },
+	{ "pertenk;", "\xe2\x80\xb1" },
+	{ "uscr;", "\xf0\x9d\x93\x8a" },
+	{ "gtrdot;", "\xe2\x8b\x97" },
+	{ "propto;", "\xe2\x88\x9d" },
+	{ "Ycy;", "\xd0\xab" },
+	{ "PrecedesEqual;", "\xe2\xaa\xaf" },
+	{ "Oscr;", "\xf0\x9d\x92\xaa" },
+	{ "nspar;", "\xe2\x88\xa6" },
+	{ "Mfr;", "\xf0\x9d\x94\x90" },
+	{ "eopf;", "\xf0\x9d\x95\x96" },
+	{ "NotTildeEqual;", "\xe2\x89\x84" },
+	{ "sigma;", "\xcf\x83" },
+	{ "NotReverseElement;", "\xe2\x88\x8c" },
+	{ "eacute;", "\xc3\xa9" },
+	{ "LessFullEqual;", "\xe2\x89\xa6" },
+	{ "iiota;", "\xe2\x84\xa9" },
+	{ "diamond;", "\xe2\x8b\x84" },
+	{ "eparsl;", "\xe2\xa7\xa3" },
+	{ "solbar;", "\xe2\x8c\xbf" },
+	{ "hookrightarrow;", "\xe2\x86\xaa" },
+	{ "blk14;", "\xe2\x96\x91" },
+	{ "Ograve", "\xc3\x92" },
+	{ "nlsim;", "\xe2\x89\xb4" },
+	{ "boxhd;", "\xe2\x94\xac" },
+	{ "LeftDownVectorBar;", "\xe2\xa5\x99" },
+	{ "duhar;", "\xe2\xa5\xaf" },
+	{ "plus;", "\x2b" },
+	{ "iocy;", "\xd1\x91" },
+	{ "rtri;", "\xe2\x96\xb9" },
+	{ "gimel;", "\xe2\x84\xb7" },
+	{ "ltlarr;", "\xe2\xa5\xb6" },
+	{ "heartsuit;", "\xe2\x99\xa5" },
+	{ "centerdot;", "\xc2\xb7" },
+	{ "ograve;", "\xc3\xb2" },
+	{ "gsime;", "\xe2\xaa\x8e" },
+	{ "NestedLessLess;", "\xe2\x89\xaa" },
+	{ "lopar;", "\xe2\xa6\x85" },
+	{ "telrec;", "\xe2\x8c\x95" },
+	{ "rpargt;", "\xe2\xa6\x94" },
+	{ "ffilig;", "\xef\xac\x83" },
+	{ "angmsdaf;", "\xe2\xa6\xad" },
+	{ "ocirc;", "\xc3\xb4" },
+	{ "scnsim;", "\xe2\x8b\xa9" },
+	{ "oscr;", "\xe2\x84\xb4" },
+	{ "boxHD;", "\xe2\x95\xa6" },
+	{ "rsqb;", "\x5d" },
+	{ "boxhu;", "\xe2\x94\xb4" },
+	{ "kscr;", "\xf0\x9d\x93\x80" },
+	{ "Agrave", "\xc3\x80" },
+	{ "sqcup;", "\xe2\x8a\x94" },
+	{ "larrtl;", "\xe2\x86\xa2" },
+	{ "Backslash;", "\xe2\x88\x96" },
+	{ "VerticalLine;", "\x7c" },
+	{ "nrtrie;", "\xe2\x8b\xad" },
+	{ "nexist;", "\xe2\x88\x84" },
+	{ "ast;", "\x2a" },
+	{ "thorn", "\xc3\xbe" },
+	{ "Downarrow;", "\xe2\x87\x93" },
+	{ "emacr;", "\xc4\x93" },
+	{ "DoubleRightArrow;", "\xe2\x87\x92" },
+	{ "rhov;", "\xcf\xb1" },
+	{ "asymp;", "\xe2\x89\x88" },
+	{ "lsh;", "\xe2\x86\xb0" },
+	{ "lesg;", "\xe2\x8b\x9a\xef\xb8\x80" },
+	{ "exponentiale;", "\xe2\x85\x87" },
+	{ "upharpoonleft;", "\xe2\x86\xbf" },
+	{ "REG", "\xc2\xae" },
+	{ "chi;", "\xcf\x87" },
+	{ "Utilde;", "\xc5\xa8" },
+	{ "lmidot;", "\xc5\x80" },
+	{ "Ecirc;", "\xc3\x8a" },
+	{ "scy;", "\xd1\x81" },
+	{ "longmapsto;", "\xe2\x9f\xbc" },
+	{ "Rcedil;", "\xc5\x96" },
+	{ "lne;", "\xe2\xaa\x87" },
+	{ "upharpoonright;", "\xe2\x86\xbe" },
+	{ "ubreve;", "\xc5\xad" },
+	{ "Rarrtl;", "\xe2\xa4\x96" },
+	{ "cularrp;", "\xe2\xa4\xbd" },
+	{ "doteq;", "\xe2\x89\x90" },
+	{ "SucceedsSlantEqual;", "\xe2\x89\xbd" },
+	{ "aacute;", "\xc3\xa1" },
+	{ "vellip;", "\xe2\x8b\xae" },
+	{ "thksim;", "\xe2\x88\xbc" },
+	{ "RightDownTeeVector;", "\xe2\xa5\x9d" },
+	{ "range;", "\xe2\xa6\xa5" },
+	{ "tdot;", "\xe2\x83\x9b" },
+	{ "gg;", "\xe2\x89\xab" },
+	{ "Lfr;", "\xf0\x9d\x94\x8f" },
+	{ "sbquo;", "\xe2\x80\x9a" },
+	{ "Pfr;", "\xf0\x9d\x94\x93" },
+	{ "CloseCurlyQuote;", "\xe2\x80\x99" },
+	{ "npreceq;", "\xe2\xaa\xaf\xcc\xb8" },
+	{ "comma;", "\x2c" },
+	{ "plusb;", "\xe2\x8a\x9e" },
+	{ "circeq;", "\xe2\x89\x97" },
+	{ "UpperRightArrow;", "\xe2\x86\x97" },
+	{ "block;", "\xe2\x96\x88" },
+	{ "orarr;", "\xe2\x86\xbb" },
+	{ "NotHumpEqual;", "\xe2\x89\x8f\xcc\xb8" },
+	{ "smtes;", "\xe2\xaa\xac\xef\xb8\x80" },
+	{ "simlE;", "\xe2\xaa\x9f" },
+	{ "DoubleLeftRightArrow;", "\xe2\x87\x94" },
+	{ "supE;", "\xe2\xab\x86" },
+	{ "wedgeq;", "\xe2\x89\x99" },
+	{ "Pi;", "\xce\xa0" },
+	{ "lltri;", "\xe2\x97\xba" },
+	{ "digamma;", "\xcf\x9d" },
+	{ "lhblk;", "\xe2\x96\x84" },
+	{ "egs;", "\xe2\xaa\x96" },
+	{ "ring;", "\xcb\x9a" },
+	{ "supsup;", "\xe2\xab\x96" },
+	{ "rarrpl;", "\xe2\xa5\x85" },
+	{ "rightrightarrows;", "\xe2\x87\x89" },
+	{ "Beta;", "\xce\x92" },
+	{ "Hstrok;", "\xc4\xa6" },
+	{ "Ouml;", "\xc3\x96" },
+	{ "preccurlyeq;", "\xe2\x89\xbc" },
+	{ "Eogon;", "\xc4\x98" },
+	{ "prec;", "\xe2\x89\xba" },
+	{ "cupdot;", "\xe2\x8a\x8d" },
+	{ "realpart;", "\xe2\x84\x9c" },
+	{ "dzigrarr;", "\xe2\x9f\xbf" },
+	{ "cfr;", "\xf0\x9d\x94\xa0" },
+	{ "Ccirc;", "\xc4\x88" },
+	{ "varsupsetneq;", "\xe2\x8a\x8b\xef\xb8\x80" },
+	{ "emptyset;", "\xe2\x88\x85" },
+	{ "GT", "\x3e" },
+	{ "ldca;", "\xe2\xa4\xb6" },
+	{ "orderof;", "\xe2\x84\xb4" },
+	{ "xlarr;", "\xe2\x9f\xb5" },
+	{ "cuesc;", "\xe2\x8b\x9f" },
+	{ "zacute;", "\xc5\xba" },
+	{ "bdquo;", "\xe2\x80\x9e" },
+	{ "Acirc;", "\xc3\x82" },
+	{ "vartriangleright;", "\xe2\x8a\xb3" },
+	{ "nleq;", "\xe2\x89\xb0" },
+	{ "nparsl;", "\xe2\xab\xbd\xe2\x83\xa5" },
+	{ "longrightarrow;", "\xe2\x9f\xb6" },
+	{ "omicron;", "\xce\xbf" },
+	{ "orslope;", "\xe2\xa9\x97" },
+	{ "Because;", "\xe2\x88\xb5" },
+	{ "sfrown;", "\xe2\x8c\xa2" },
+	{ "Cross;", "\xe2\xa8\xaf" },
+	{ "succneqq;", "\xe2\xaa\xb6" },
+	{ "boxhD;", "\xe2\x95\xa5" },
+	{ "varpropto;", "\xe2\x88\x9d" },
+	{ "ForAll;", "\xe2\x88\x80" },
+	{ "uml;", "\xc2\xa8" },
+	{ "nequiv;", "\xe2\x89\xa2" },
+	{ "nbsp", "\xc2\xa0" },
+	{ "NotRightTriangleBar;", "\xe2\xa7\x90\xcc\xb8" },
+	{ "Rarr;", "\xe2\x86\xa0" },
+	{ "xopf;", "\xf0\x9d\x95\xa9" },
+	{ "nVdash;", "\xe2\x8a\xae" },
+	{ "erDot;", "\xe2\x89\x93" },
+	{ "rbrace;", "\x7d" },
+	{ "supe;", "\xe2\x8a\x87" },
+	{ "hookleftarrow;", "\xe2\x86\xa9" },
+	{ "lArr;", "\xe2\x87\x90" },
+	{ "Topf;", "\xf0\x9d\x95\x8b" },
+	{ "zdot;", "\xc5\xbc" },
+	{ "fnof;", "\xc6\x92" },
+	{ "diamondsuit;", "\xe2\x99\xa6" },
+	{ "iuml;", "\xc3\xaf" },
+	{ "NotPrecedesSlantEqual;", "\xe2\x8b\xa0" },
+	{ "NotExists;", "\xe2\x88\x84" },
+	{ "Sigma;", "\xce\xa3" },
+	{ "Omacr;", "\xc5\x8c" },
+	{ "curarrm;", "\xe2\xa4\xbc" },
+	{ "CircleMinus;", "\xe2\x8a\x96" },
+	{ "coloneq;", "\xe2\x89\x94" },
+	{ "UnderParenthesis;", "\xe2\x8f\x9d" },
+	{ "wedge;", "\xe2\x88\xa7" },
+	{ "ngeq;", "\xe2\x89\xb1" },
+	{ "uopf;", "\xf0\x9d\x95\xa6" },
+	{ "ccaron;", "\xc4\x8d" },
+	{ "sqsube;", "\xe2\x8a\x91" },
+	{ "RightDownVectorBar;", "\xe2\xa5\x95" },
+	{ "nless;", "\xe2\x89\xae" },
+	{ "NotSubsetEqual;", "\xe2\x8a\x88" },
+	{ "CircleTimes;", "\xe2\x8a\x97" },
+	{ "fscr;", "\xf0\x9d\x92\xbb" },
+	{ "lowbar;", "\x5f" },
+	{ "ltdot;", "\xe2\x8b\x96" },
+	{ "LeftTriangle;", "\xe2\x8a\xb2" },
+	{ "ap;", "\xe2\x89\x88" },
+	{ "rtriltri;", "\xe2\xa7\x8e" },
+	{ "aacute", "\xc3\xa1" },
+	{ "Nu;", "\xce\x9d" },
+	{ "squ;", "\xe2\x96\xa1" },
+	{ "Racute;", "\xc5\x94" },
+	{ "sub;", "\xe2\x8a\x82" },
+	{ "nvltrie;", "\xe2\x8a\xb4\xe2\x83\x92" },
+	{ "Rang;", "\xe2\x9f\xab" },
+	{ "DownLeftVectorBar;", "\xe2\xa5\x96" },
+	{ "DDotrahd;", "\xe2\xa4\x91" },
+	{ "swarhk;", "\xe2\xa4\xa6" },
+	{ "Succeeds;", "\xe2\x89\xbb" },
+	{ "hopf;", "\xf0\x9d\x95\x99" },
+	{ "Auml;", "\xc3\x84" },
+	{ "ange;", "\xe2\xa6\xa4" },
+	{ "eg;", "\xe2\xaa\x9a" },
+	{ "boxUl;", "\xe2\x95\x9c" },
+	{ "mfr;", "\xf0\x9d\x94\xaa" },
+	{ "SquareSuperset;", "\xe2\x8a\x90" },
+	{ "DoubleUpArrow;", "\xe2\x87\x91" },
+	{ "DiacriticalGrave;", "\x60" },
+	{ "gescc;", "\xe2\xaa\xa9" },
+	{ "nsc;", "\xe2\x8a\x81" },
+	{ "boxul;", "\xe2\x94\x98" },
+	{ "utri;", "\xe2\x96\xb5" },
+	{ "sopf;", "\xf0\x9d\x95\xa4" },
+	{ "natur;", "\xe2\x99\xae" },
+	{ "Lcaron;", "\xc4\xbd" },
+	{ "umacr;", "\xc5\xab" },
+	{ "NotLessGreater;", "\xe2\x89\xb8" },
+	{ "langle;", "\xe2\x9f\xa8" },
+	{ "jfr;", "\xf0\x9d\x94\xa7" },
+	{ "laquo", "\xc2\xab" },
+	{ "sdote;", "\xe2\xa9\xa6" },
+	{ "gvertneqq;", "\xe2\x89\xa9\xef\xb8\x80" },
+	{ "LowerRightArrow;", "\xe2\x86\x98" },
+	{ "Yacute", "\xc3\x9d" },
+	{ "andd;", "\xe2\xa9\x9c" },
+	{ "alpha;", "\xce\xb1" },
+	{ "boxv;", "\xe2\x94\x82" },
+	{ "LessEqualGreater;", "\xe2\x8b\x9a" },
+	{ "NotGreaterLess;", "\xe2\x89\xb9" },
+	{ "divide", "\xc3\xb7" },
+	{ "Vfr;", "\xf0\x9d\x94\x99" },
+	{ "times;", "\xc3\x97" },
+	{ "SHcy;", "\xd0\xa8" },
+	{ "REG;", "\xc2\xae" },
+	{ "Escr;", "\xe2\x84\xb0" },
+	{ "quot", "\x22" },
+	{ "awconint;", "\xe2\x88\xb3" },
+	{ "sup3;", "\xc2\xb3" },
+	{ "nsupe;", "\xe2\x8a\x89" },
+	{ "tcy;", "\xd1\x82" },
+	{ "gnsim;", "\xe2\x8b\xa7" },
+	{ "SquareSubset;", "\xe2\x8a\x8f" },
+	{ "boxtimes;", "\xe2\x8a\xa0" },
+	{ "nvlArr;", "\xe2\xa4\x82" },
+	{ "andslope;", "\xe2\xa9\x98" },
+	{ "tcaron;", "\xc5\xa5" },
+	{ "yacute", "\xc3\xbd" },
+	{ "iquest", "\xc2\xbf" },
+	{ "ntilde;", "\xc3\xb1" },
+	{ "Esim;", "\xe2\xa9\xb3" },
+	{ "rharul;", "\xe2\xa5\xac" },
+	{ "dagger;", "\xe2\x80\xa0" },
+	{ "rdldhar;", "\xe2\xa5\xa9" },
+	{ "mnplus;", "\xe2\x88\x93" },
+	{ "ecy;", "\xd1\x8d" },
+	{ "circlearrowleft;", "\xe2\x86\xba" },
+	{ "RightTriangleEqual;", "\xe2\x8a\xb5" },
+	{ "rcedil;", "\xc5\x97" },
+	{ "blacksquare;", "\xe2\x96\xaa" },
+	{ "Iacute;", "\xc3\x8d" },
+	{ "succnsim;", "\xe2\x8b\xa9" },
+	{ "daleth;", "\xe2\x84\xb8" },
+	{ "clubs;", "\xe2\x99\xa3" },
+	{ "DD;", "\xe2\x85\x85" },
+	{ "infin;", "\xe2\x88\x9e" },
+	{ "ShortDownArrow;", "\xe2\x86\x93" },
+	{ "Lsh;", "\xe2\x86\xb0" },
+	{ "mDDot;", "\xe2\x88\xba" },
+	{ "lrhard;", "\xe2\xa5\xad" },
+	{ "barvee;", "\xe2\x8a\xbd" },
+	{ "UpDownArrow;", "\xe2\x86\x95" },
+	{ "lesseqgtr;", "\xe2\x8b\x9a" },
+	{ "NotCupCap;", "\xe2\x89\xad" },
+	{ "Lleftarrow;", "\xe2\x87\x9a" },
+	{ "ascr;", "\xf0\x9d\x92\xb6" },
+	{ "trianglerighteq;", "\xe2\x8a\xb5" },
+	{ "niv;", "\xe2\x88\x8b" },
+	{ "RightArrowBar;", "\xe2\x87\xa5" },
+	{ "NegativeThinSpace;", "\xe2\x80\x8b" },
+	{ "OverBracket;", "\xe2\x8e\xb4" },
+	{ "zigrarr;", "\xe2\x87\x9d" },
+	{ "Ncedil;", "\xc5\x85" },
+	{ "chcy;", "\xd1\x87" },
+	{ "smallsetminus;", "\xe2\x88\x96" },
+	{ "atilde;", "\xc3\xa3" },
+	{ "gtdot;", "\xe2\x8b\x97" },
+	{ "rAarr;", "\xe2\x87\x9b" },
+	{ "NotLeftTriangleBar;", "\xe2\xa7\x8f\xcc\xb8" },
+	{ "drcrop;", "\xe2\x8c\x8c" },
+	{ "kappav;", "\xcf\xb0" },
+	{ "laemptyv;", "\xe2\xa6\xb4" },
+	{ "ClockwiseContourIntegral;", "\xe2\x88\xb2" },
+	{ "cuwed;", "\xe2\x8b\x8f" },
+	{ "CirclePlus;", "\xe2\x8a\x95" },
+	{ "boxVL;", "\xe2\x95\xa3" },
+	{ "Iota;", "\xce\x99" },
+	{ "dotsquare;", "\xe2\x8a\xa1" },
+	{ "lesdot;", "\xe2\xa9\xbf" },
+	{ "nhpar;", "\xe2\xab\xb2" },
+	{ "aring", "\xc3\xa5" },
+	{ "prnap;", "\xe2\xaa\xb9" },
+	{ "szlig;", "\xc3\x9f" },
+	{ "oopf;", "\xf0\x9d\x95\xa0" },
+	{ "LeftAngleBracket;", "\xe2\x9f\xa8" },
+	{ "tridot;", "\xe2\x97\xac" },
+	{ "Gt;", "\xe2\x89\xab" },
+	{ "nang;", "\xe2\x88\xa0\xe2\x83\x92" },
+	{ "sup1;", "\xc2\xb9" },
+	{ "bigtriangledown;", "\xe2\x96\xbd" },
+	{ "khcy;", "\xd1\x85" },
+	{ "ApplyFunction;", "\xe2\x81\xa1" },
+	{ "nfr;", "\xf0\x9d\x94\xab" },
+	{ "Euml;", "\xc3\x8b" },
+	{ "xuplus;", "\xe2\xa8\x84" },
+	{ "xvee;", "\xe2\x8b\x81" },
+	{ "congdot;", "\xe2\xa9\xad" },
+	{ "bigtriangleup;", "\xe2\x96\xb3" },
+	{ "ocirc", "\xc3\xb4" },
+	{ "fcy;", "\xd1\x84" },
+	{ "tilde;", "\xcb\x9c" },
+	{ "lacute;", "\xc4\xba" },
+	{ "setminus;", "\xe2\x88\x96" },
+	{ "RightUpVectorBar;", "\xe2\xa5\x94" },
+	{ "rarrfs;", "\xe2\xa4\x9e" },
+	{ "radic;", "\xe2\x88\x9a" },
+	{ "geqslant;", "\xe2\xa9\xbe" },
+	{ "nlarr;", "\xe2\x86\x9a" },
+	{ "notinvc;", "\xe2\x8b\xb6" },
+	{ "Cconint;", "\xe2\x88\xb0" },
+	{ "supsub;", "\xe2\xab\x94" },
+	{ "dtrif;", "\xe2\x96\xbe" },
+	{ "suphsub;", "\xe2\xab\x97" },
+	{ "macr;", "\xc2\xaf" },
+	{ "rarrbfs;", "\xe2\xa4\xa0" },
+	{ "vltri;", "\xe2\x8a\xb2" },
+	{ "delta;", "\xce\xb4" },
+	{ "preceq;", "\xe2\xaa\xaf" },
+	{ "subrarr;", "\xe2\xa5\xb9" },
+	{ "pcy;", "\xd0\xbf" },
+	{ "Eacute", "\xc3\x89" },
+	{ "Ifr;", "\xe2\x84\x91" },
+	{ "DownLeftTeeVector;", "\xe2\xa5\x9e" },
+	{ "dbkarow;", "\xe2\xa4\x8f" },
+	{ "zscr;", "\xf0\x9d\x93\x8f" },
+	{ "SupersetEqual;", "\xe2\x8a\x87" },
+	{ "blacktriangle;", "\xe2\x96\xb4" },
+	{ "bsolhsub;", "\xe2\x9f\x88" },
+	{ "raemptyv;", "\xe2\xa6\xb3" },
+	{ "boxvR;", "\xe2\x95\x9e" },
+	{ "boxV;", "\xe2\x95\x91" },
+	{ "coprod;", "\xe2\x88\x90" },
+	{ "Lmidot;", "\xc4\xbf" },
+	{ "bigvee;", "\xe2\x8b\x81" },
+	{ "frac34", "\xc2\xbe" },
+	{ "Laplacetrf;", "\xe2\x84\x92" },
+	{ "Rho;", "\xce\xa1" },
+	{ "uring;", "\xc5\xaf" },
+	{ "NotVerticalBar;", "\xe2\x88\xa4" },
+	{ "ntriangleleft;", "\xe2\x8b\xaa" },
+	{ "varkappa;", "\xcf\xb0" },
+	{ "ShortRightArrow;", "\xe2\x86\x92" },
+	{ "LeftTeeArrow;", "\xe2\x86\xa4" },
+	{ "aleph;", "\xe2\x84\xb5" },
+	{ "boxHU;", "\xe2\x95\xa9" },
+	{ "real;", "\xe2\x84\x9c" },
+	{ "Yopf;", "\xf0\x9d\x95\x90" },
+	{ "sqcups;", "\xe2\x8a\x94\xef\xb8\x80" },
+	{ "divide;", "\xc3\xb7" },
+	{ "frac16;", "\xe2\x85\x99" },
+	{ "sung;", "\xe2\x99\xaa" },
+	{ "LeftUpVectorBar;", "\xe2\xa5\x98" },
+	{ "Ubreve;", "\xc5\xac" },
+	{ "Rsh;", "\xe2\x86\xb1" },
+	{ "supseteqq;", "\xe2\xab\x86" },
+	{ "DotDot;", "\xe2\x83\x9c" },
+	{ "gammad;", "\xcf\x9d" },
+	{ "cscr;", "\xf0\x9d\x92\xb8" },
+	{ "gtrless;", "\xe2\x89\xb7" },
+	{ "Wcirc;", "\xc5\xb4" },
+	{ "bNot;", "\xe2\xab\xad" },
+	{ "kfr;", "\xf0\x9d\x94\xa8" },
+	{ "Qfr;", "\xf0\x9d\x94\x94" },
+	{ "lt", "\x3c" },
+	{ "varrho;", "\xcf\xb1" },
+	{ "larrbfs;", "\xe2\xa4\x9f" },
+	{ "iota;", "\xce\xb9" },
+	{ "ubrcy;", "\xd1\x9e" },
+	{ "thinsp;", "\xe2\x80\x89" },
+	{ "shcy;", "\xd1\x88" },
+	{ "Iopf;", "\xf0\x9d\x95\x80" },
+	{ "nexists;", "\xe2\x88\x84" },
+	{ "equals;", "\x3d" },
+	{ "perp;", "\xe2\x8a\xa5" },
+	{ "Imacr;", "\xc4\xaa" },
+	{ "THORN", "\xc3\x9e" },
+	{ "ncup;", "\xe2\xa9\x82" },
+	{ "Lopf;", "\xf0\x9d\x95\x83" },
+	{ "Diamond;", "\xe2\x8b\x84" },
+	{ "blank;", "\xe2\x90\xa3" },
+	{ "NotLessEqual;", "\xe2\x89\xb0" },
+	{ "backsim;", "\xe2\x88\xbd" },
+	{ "leftleftarrows;", "\xe2\x87\x87" },
+	{ "dollar;", "\x24" },
+	{ "Agrave;", "\xc3\x80" },
+	{ "rightthreetimes;", "\xe2\x8b\x8c" },
+	{ "lsim;", "\xe2\x89\xb2" },
+	{ "zfr;", "\xf0\x9d\x94\xb7" },
+	{ "bsolb;", "\xe2\xa7\x85" },
+	{ "rarrap;", "\xe2\xa5\xb5" },
+	{ "Oslash", "\xc3\x98" },
+	{ "bigodot;", "\xe2\xa8\x80" },
+	{ "nLl;", "\xe2\x8b\x98\xcc\xb8" },
+	{ "brvbar;", "\xc2\xa6" },
+	{ "ensp;", "\xe2\x80\x82" },
+	{ "top;", "\xe2\x8a\xa4" },
+	{ "cupor;", "\xe2\xa9\x85" },
+	{ "xoplus;", "\xe2\xa8\x81" },
+	{ "Mopf;", "\xf0\x9d\x95\x84" },
+	{ "iscr;", "\xf0\x9d\x92\xbe" },
+	{ "oelig;", "\xc5\x93" },
+	{ "sect", "\xc2\xa7" },
+	{ "epar;", "\xe2\x8b\x95" },
+	{ "oast;", "\xe2\x8a\x9b" },
+	{ "Icirc;", "\xc3\x8e" },
+	{ "imath;", "\xc4\xb1" },
+	{ "curren;", "\xc2\xa4" },
+	{ "uogon;", "\xc5\xb3" },
+	{ "bumpeq;", "\xe2\x89\x8f" },
+	{ "rscr;", "\xf0\x9d\x93\x87" },
+	{ "nvle;", "\xe2\x89\xa4\xe2\x83\x92" },
+	{ "boxUr;", "\xe2\x95\x99" },
+	{ "ufr;", "\xf0\x9d\x94\xb2" },
+	{ "integers;", "\xe2\x84\xa4" },
+	{ "angrt;", "\xe2\x88\x9f" },
+	{ "Ncaron;", "\xc5\x87" },
+	{ "lneq;", "\xe2\xaa\x87" },
+	{ "curren", "\xc2\xa4" },
+	{ "Ecy;", "\xd0\xad" },
+	{ "DoubleContourIntegral;", "\xe2\x88\xaf" },
+	{ "nrarr;", "\xe2\x86\x9b" },
+	{ "xscr;", "\xf0\x9d\x93\x8d" },
+	{ "topfork;", "\xe2\xab\x9a" },
+	{ "mu;", "\xce\xbc" },
+	{ "nmid;", "\xe2\x88\xa4" },
+	{ "DoubleVerticalBar;", "\xe2\x88\xa5" },
+	{ "tosa;", "\xe2\xa4\xa9" },
+	{ "not", "\xc2\xac" },
+	{ "kcy;", "\xd0\xba" },
+	{ "Tcy;", "\xd0\xa2" },
+	{ "rBarr;", "\xe2\xa4\x8f" },
+	{ "angrtvb;", "\xe2\x8a\xbe" },
+	{ "iecy;", "\xd0\xb5" },
+	{ "ee;", "\xe2\x85\x87" },
+	{ "precsim;", "\xe2\x89\xbe" },
+	{ "LeftDoubleBracket;", "\xe2\x9f\xa6" },
+	{ "amp", "\x26" },
+	{ "ouml", "\xc3\xb6" },
+	{ "bne;", "\x3d\xe2\x83\xa5" },
+	{ "CounterClockwiseContourIntegral;", "\xe2\x88\xb3" },
+	{ "wr;", "\xe2\x89\x80" },
+	{ "Dcy;", "\xd0\x94" },
+	{ "nVDash;", "\xe2\x8a\xaf" },
+	{ "egsdot;", "\xe2\xaa\x98" },
+	{ "cudarrr;", "\xe2\xa4\xb5" },
+	{ "LT", "\x3c" },
+	{ "robrk;", "\xe2\x9f\xa7" },
+	{ "odsold;", "\xe2\xa6\xbc" },
+	{ "sqsup;", "\xe2\x8a\x90" },
+	{ "Gdot;", "\xc4\xa0" },
+	{ "tshcy;", "\xd1\x9b" },
+	{ "RightUpVector;", "\xe2\x86\xbe" },
+	{ "Tstrok;", "\xc5\xa6" },
+	{ "Vee;", "\xe2\x8b\x81" },
+	{ "Gfr;", "\xf0\x9d\x94\x8a" },
+	{ "questeq;", "\xe2\x89\x9f" },
+	{ "jsercy;", "\xd1\x98" },
+	{ "shortmid;", "\xe2\x88\xa3" },
+	{ "par;", "\xe2\x88\xa5" },
+	{ "luruhar;", "\xe2\xa5\xa6" },
+	{ "vzigzag;", "\xe2\xa6\x9a" },
+	{ "hslash;", "\xe2\x84\x8f" },
+	{ "SquareSupersetEqual;", "\xe2\x8a\x92" },
+	{ "natural;", "\xe2\x99\xae" },
+	{ "gnapprox;", "\xe2\xaa\x8a" },
+	{ "mapstoleft;", "\xe2\x86\xa4" },
+	{ "succsim;", "\xe2\x89\xbf" },
+	{ "crarr;", "\xe2\x86\xb5" },
+	{ "rnmid;", "\xe2\xab\xae" },
+	{ "sim;", "\xe2\x88\xbc" },
+	{ "checkmark;", "\xe2\x9c\x93" },
+	{ "trade;", "\xe2\x84\xa2" },
+	{ "Scedil;", "\xc5\x9e" },
+	{ "DZcy;", "\xd0\x8f" },
+	{ "xfr;", "\xf0\x9d\x94\xb5" },
+	{ "Conint;", "\xe2\x88\xaf" },
+	{ "because;", "\xe2\x88\xb5" },
+	{ "Ufr;", "\xf0\x9d\x94\x98" },
+	{ "gfr;", "\xf0\x9d\x94\xa4" },
+	{ "FilledSmallSquare;", "\xe2\x97\xbc" },
+	{ "wreath;", "\xe2\x89\x80" },
+	{ "rx;", "\xe2\x84\x9e" },
+	{ "bowtie;", "\xe2\x8b\x88" },
+	{ "mumap;", "\xe2\x8a\xb8" },
+	{ "sigmav;", "\xcf\x82" },
+	{ "osol;", "\xe2\x8a\x98" },
+	{ "iiiint;", "\xe2\xa8\x8c" },
+	{ "LongRightArrow;", "\xe2\x9f\xb6" },
+	{ "ord;", "\xe2\xa9\x9d" },
+	{ "blacktriangleright;", "\xe2\x96\xb8" },
+	{ "Gamma;", "\xce\x93" },
+	{ "Iuml;", "\xc3\x8f" },
+	{ "rtrie;", "\xe2\x8a\xb5" },
+	{ "Uring;", "\xc5\xae" },
+	{ "LeftFloor;", "\xe2\x8c\x8a" },
+	{ "Ntilde", "\xc3\x91" },
+	{ "Oacute", "\xc3\x93" },
+	{ "rarrw;", "\xe2\x86\x9d" },
+	{ "NotSquareSubset;", "\xe2\x8a\x8f\xcc\xb8" },
+	{ "OverBrace;", "\xe2\x8f\x9e" },
+	{ "rightarrow;", "\xe2\x86\x92" },
+	{ "sqsupseteq;", "\xe2\x8a\x92" },
+	{ "Sup;", "\xe2\x8b\x91" },
+	{ "HumpEqual;", "\xe2\x89\x8f" },
+	{ "LeftTee;", "\xe2\x8a\xa3" },
+	{ "RightFloor;", "\xe2\x8c\x8b" },
+	{ "lfloor;", "\xe2\x8c\x8a" },
+	{ "ufisht;", "\xe2\xa5\xbe" },
+	{ "el;", "\xe2\xaa\x99" },
+	{ "SquareUnion;", "\xe2\x8a\x94" },
+	{ "capand;", "\xe2\xa9\x84" },
+	{ "veebar;", "\xe2\x8a\xbb" },
+	{ "THORN;", "\xc3\x9e" },
+	{ "oslash;", "\xc3\xb8" },
+	{ "frac12", "\xc2\xbd" },
+	{ "HorizontalLine;", "\xe2\x94\x80" },
+	{ "mid;", "\xe2\x88\xa3" },
+	{ "leftarrowtail;", "\xe2\x86\xa2" },
+	{ "RightTeeArrow;", "\xe2\x86\xa6" },
+	{ "olcross;", "\xe2\xa6\xbb" },
+	{ "sqsub;", "\xe2\x8a\x8f" },
+	{ "capcup;", "\xe2\xa9\x87" },
+	{ "Iscr;", "\xe2\x84\x90" },
+	{ "Del;", "\xe2\x88\x87" },
+	{ "Wfr;", "\xf0\x9d\x94\x9a" },
+	{ "NotSuperset;", "\xe2\x8a\x83\xe2\x83\x92" },
+	{ "Nfr;", "\xf0\x9d\x94\x91" },
+	{ "NotLessSlantEqual;", "\xe2\xa9\xbd\xcc\xb8" },
+	{ "Dopf;", "\xf0\x9d\x94\xbb" },
+	{ "nLt;", "\xe2\x89\xaa\xe2\x83\x92" },
+	{ "beth;", "\xe2\x84\xb6" },
+	{ "icirc", "\xc3\xae" },
+	{ "demptyv;", "\xe2\xa6\xb1" },
+	{ "pound;", "\xc2\xa3" },
+	{ "sdotb;", "\xe2\x8a\xa1" },
+	{ "itilde;", "\xc4\xa9" },
+	{ "NotGreater;", "\xe2\x89\xaf" },
+	{ "conint;", "\xe2\x88\xae" },
+	{ "cdot;", "\xc4\x8b" },
+	{ "odiv;", "\xe2\xa8\xb8" },
+	{ "LeftUpTeeVector;", "\xe2\xa5\xa0" },
+	{ "curlyvee;", "\xe2\x8b\x8e" },
+	{ "male;", "\xe2\x99\x82" },
+	{ "oacute;", "\xc3\xb3" },
+	{ "bkarow;", "\xe2\xa4\x8d" },
+	{ "gtreqqless;", "\xe2\xaa\x8c" },
+	{ "empty;", "\xe2\x88\x85" },
+	{ "ntgl;", "\xe2\x89\xb9" },
+	{ "nshortmid;", "\xe2\x88\xa4" },
+	{ "TRADE;", "\xe2\x84\xa2" },
+	{ "ijlig;", "\xc4\xb3" },
+	{ "ucirc", "\xc3\xbb" },
+	{ "not;", "\xc2\xac" },
+	{ "Im;", "\xe2\x84\x91" },
+	{ "smashp;", "\xe2\xa8\xb3" },
+	{ "bnot;", "\xe2\x8c\x90" },
+	{ "AMP", "\x26" },
+	{ "cap;", "\xe2\x88\xa9" },
+	{ "diam;", "\xe2\x8b\x84" },
+	{ "NotSquareSupersetEqual;", "\xe2\x8b\xa3" },
+	{ "triminus;", "\xe2\xa8\xba" },
+	{ "bigcirc;", "\xe2\x97\xaf" },
+	{ "Tscr;", "\xf0\x9d\x92\xaf" },
+	{ "NotHumpDownHump;", "\xe2\x89\x8e\xcc\xb8" },
+	{ "smile;", "\xe2\x8c\xa3" },
+	{ "andv;", "\xe2\xa9\x9a" },
+	{ "dopf;", "\xf0\x9d\x95\x95" },
+	{ "awint;", "\xe2\xa8\x91" },
+	{ "NotRightTriangle;", "\xe2\x8b\xab" },
+	{ "lsquor;", "\xe2\x80\x9a" },
+	{ "nrtri;", "\xe2\x8b\xab" },
+	{ "nltrie;", "\xe2\x8b\xac" },
+	{ "isin;", "\xe2\x88\x88" },
+	{ "ntrianglelefteq;", "\xe2\x8b\xac" },
+	{ "nabla;", "\xe2\x88\x87" },
+	{ "iogon;", "\xc4\xaf" },
+	{ "nsup;", "\xe2\x8a\x85" },
+	{ "frac38;", "\xe2\x85\x9c" },
+	{ "igrave;", "\xc3\xac" },
+	{ "supdsub;", "\xe2\xab\x98" },
+	{ "popf;", "\xf0\x9d\x95\xa1" },
+	{ "lvertneqq;", "\xe2\x89\xa8\xef\xb8\x80" },
+	{ "frac34;", "\xc2\xbe" },
+	{ "approxeq;", "\xe2\x89\x8a" },
+	{ "sc;", "\xe2\x89\xbb" },
+	{ "Updownarrow;", "\xe2\x87\x95" },
+	{ "acd;", "\xe2\x88\xbf" },
+	{ "iuml", "\xc3\xaf" },
+	{ "rationals;", "\xe2\x84\x9a" },
+	{ "qfr;", "\xf0\x9d\x94\xae" },
+	{ "subsim;", "\xe2\xab\x87" },
+	{ "thetav;", "\xcf\x91" },
+	{ "NotSucceedsEqual;", "\xe2\xaa\xb0\xcc\xb8" },
+	{ "GreaterEqual;", "\xe2\x89\xa5" },
+	{ "alefsym;", "\xe2\x84\xb5" },
+	{ "piv;", "\xcf\x96" },
+	{ "NoBreak;", "\xe2\x81\xa0" },
+	{ "auml;", "\xc3\xa4" },
+	{ "nleqslant;", "\xe2\xa9\xbd\xcc\xb8" },
+	{ "frac35;", "\xe2\x85\x97" },
+	{ "bumpe;", "\xe2\x89\x8f" },
+	{ "boxUR;", "\xe2\x95\x9a" },
+	{ "LeftUpDownVector;", "\xe2\xa5\x91" },
+	{ "nltri;", "\xe2\x8b\xaa" },
+	{ "Verbar;", "\xe2\x80\x96" },
+	{ "plusmn;", "\xc2\xb1" },
+	{ "DownArrow;", "\xe2\x86\x93" },
+	{ "scedil;", "\xc5\x9f" },
+	{ "Itilde;", "\xc4\xa8" },
+	{ "QUOT", "\x22" },
+	{ "YIcy;", "\xd0\x87" },
+	{ "eacute", "\xc3\xa9" },
+	{ "compfn;", "\xe2\x88\x98" },
+	{ "intprod;", "\xe2\xa8\xbc" },
+	{ "gnap;", "\xe2\xaa\x8a" },
+	{ "Alpha;", "\xce\x91" },
+	{ "nrarrc;", "\xe2\xa4\xb3\xcc\xb8" },
+	{ "Lt;", "\xe2\x89\xaa" },
+	{ "iacute", "\xc3\xad" },
+	{ "nsucceq;", "\xe2\xaa\xb0\xcc\xb8" },
+	{ "ohm;", "\xce\xa9" },
+	{ "PrecedesSlantEqual;", "\xe2\x89\xbc" },
+	{ "boxUL;", "\xe2\x95\x9d" },
+	{ "plusacir;", "\xe2\xa8\xa3" },
+	{ "tint;", "\xe2\x88\xad" },
+	{ "ordf", "\xc2\xaa" },
+	{ "ntlg;", "\xe2\x89\xb8" },
+	{ "TSHcy;", "\xd0\x8b" },
+	{ "bigoplus;", "\xe2\xa8\x81" },
+	{ "qprime;", "\xe2\x81\x97" },
+	{ "map;", "\xe2\x86\xa6" },
+	{ "leftthreetimes;", "\xe2\x8b\x8b" },
+	{ "nsucc;", "\xe2\x8a\x81" },
+	{ "utdot;", "\xe2\x8b\xb0" },
+	{ "doublebarwedge;", "\xe2\x8c\x86" },
+	{ "submult;", "\xe2\xab\x81" },
+	{ "Dagger;", "\xe2\x80\xa1" },
+	{ "prnsim;", "\xe2\x8b\xa8" },
+	{ "bigcap;", "\xe2\x8b\x82" },
+	{ "Wscr;", "\xf0\x9d\x92\xb2" },
+	{ "ndash;", "\xe2\x80\x93" },
+	{ "udarr;", "\xe2\x87\x85" },
+	{ "lopf;", "\xf0\x9d\x95\x9d" },
+	{ "subsetneqq;", "\xe2\xab\x8b" },
+	{ "lessapprox;", "\xe2\xaa\x85" },
+	{ "times", "\xc3\x97" },
+	{ "rthree;", "\xe2\x8b\x8c" },
+	{ "notni;", "\xe2\x88\x8c" },
+	{ "gesdoto;", "\xe2\xaa\x82" },
+	{ "gtcc;", "\xe2\xaa\xa7" },
+	{ "Rfr;", "\xe2\x84\x9c" },
+	{ "Tilde;", "\xe2\x88\xbc" },
+	{ "spar;", "\xe2\x88\xa5" },
+	{ "GT;", "\x3e" },
+	{ "gtlPar;", "\xe2\xa6\x95" },
+	{ "excl;", "\x21" },
+	{ "zeetrf;", "\xe2\x84\xa8" },
+	{ "cylcty;", "\xe2\x8c\xad" },
+	{ "dlcrop;", "\xe2\x8c\x8d" },
+	{ "Epsilon;", "\xce\x95" },
+	{ "Zcaron;", "\xc5\xbd" },
+	{ "epsiv;", "\xcf\xb5" },
+	{ "cupbrcap;", "\xe2\xa9\x88" },
+	{ "bsim;", "\xe2\x88\xbd" },
+	{ "scnE;", "\xe2\xaa\xb6" },
+	{ "gla;", "\xe2\xaa\xa5" },
+	{ "ecolon;", "\xe2\x89\x95" },
+	{ "boxuL;", "\xe2\x95\x9b" },
+	{ "rsquo;", "\xe2\x80\x99" },
+	{ "DoubleLongRightArrow;", "\xe2\x9f\xb9" },
+	{ "Idot;", "\xc4\xb0" },
+	{ "circledR;", "\xc2\xae" },
+	{ "scE;", "\xe2\xaa\xb4" },
+	{ "KHcy;", "\xd0\xa5" },
+	{ "urcrop;", "\xe2\x8c\x8e" },
+	{ "oline;", "\xe2\x80\xbe" },
+	{ "vsupnE;", "\xe2\xab\x8c\xef\xb8\x80" },
+	{ "die;", "\xc2\xa8" },
+	{ "Ugrave;", "\xc3\x99" },
+	{ "square;", "\xe2\x96\xa1" },
+	{ "ltcc;", "\xe2\xaa\xa6" },
+	{ "boxbox;", "\xe2\xa7\x89" },
+	{ "RightDownVector;", "\xe2\x87\x82" },
+	{ "eqslantgtr;", "\xe2\xaa\x96" },
+	{ "nsubE;", "\xe2\xab\x85\xcc\xb8" },
+	{ "supsim;", "\xe2\xab\x88" },
+	{ "shchcy;", "\xd1\x89" },
+	{ "plusdo;", "\xe2\x88\x94" },
+	{ "DoubleLongLeftRightArrow;", "\xe2\x9f\xba" },
+	{ "lap;", "\xe2\xaa\x85" },
+	{ "sce;", "\xe2\xaa\xb0" },
+	{ "yen", "\xc2\xa5" },
+	{ "plustwo;", "\xe2\xa8\xa7" },
+	{ "Therefore;", "\xe2\x88\xb4" },
+	{ "rightarrowtail;", "\xe2\x86\xa3" },
+	{ "lesges;", "\xe2\xaa\x93" },
+	{ "EmptySmallSquare;", "\xe2\x97\xbb" },
+	{ "LeftTeeVector;", "\xe2\xa5\x9a" },
+	{ "yscr;", "\xf0\x9d\x93\x8e" },
+	{ "epsi;", "\xce\xb5" },
+	{ "nle;", "\xe2\x89\xb0" },
+	{ "gamma;", "\xce\xb3" },
+	{ "blk12;", "\xe2\x96\x92" },
+	{ "Cfr;", "\xe2\x84\xad" },
+	{ "circleddash;", "\xe2\x8a\x9d" },
+	{ "larrfs;", "\xe2\xa4\x9d" },
+	{ "udblac;", "\xc5\xb1" },
+	{ "rmoustache;", "\xe2\x8e\xb1" },
+	{ "Xfr;", "\xf0\x9d\x94\x9b" },
+	{ "blk34;", "\xe2\x96\x93" },
+	{ "nGtv;", "\xe2\x89\xab\xcc\xb8" },
+	{ "raquo", "\xc2\xbb" },
+	{ "Abreve;", "\xc4\x82" },
+	{ "xlArr;", "\xe2\x9f\xb8" },
+	{ "Vcy;", "\xd0\x92" },
+	{ "triangleq;", "\xe2\x89\x9c" },
+	{ "bemptyv;", "\xe2\xa6\xb0" },
+	{ "Hacek;", "\xcb\x87" },
+	{ "cuepr;", "\xe2\x8b\x9e" },
+	{ "percnt;", "\x25" },
+	{ "nldr;", "\xe2\x80\xa5" },
+	{ "ne;", "\xe2\x89\xa0" },
+	{ "ltri;", "\xe2\x97\x83" },
+	{ "vrtri;", "\xe2\x8a\xb3" },
+	{ "fopf;", "\xf0\x9d\x95\x97" },
+	{ "Qopf;", "\xe2\x84\x9a" },
+	{ "frac15;", "\xe2\x85\x95" },
+	{ "ge;", "\xe2\x89\xa5" },
+	{ "nrArr;", "\xe2\x87\x8f" },
+	{ "uuarr;", "\xe2\x87\x88" },
+	{ "lharul;", "\xe2\xa5\xaa" },
+	{ "parsl;", "\xe2\xab\xbd" },
+	{ "gneq;", "\xe2\xaa\x88" },
+	{ "wopf;", "\xf0\x9d\x95\xa8" },
+	{ "andand;", "\xe2\xa9\x95" },
+	{ "escr;", "\xe2\x84\xaf" },
+	{ "iff;", "\xe2\x87\x94" },
+	{ "kopf;", "\xf0\x9d\x95\x9c" },
+	{ "boxur;", "\xe2\x94\x94" },
+	{ "boxuR;", "\xe2\x95\x98" },
+	{ "between;", "\xe2\x89\xac" },
+	{ "mstpos;", "\xe2\x88\xbe" },
+	{ "nedot;", "\xe2\x89\x90\xcc\xb8" },
+	{ "Phi;", "\xce\xa6" },
+	{ "hardcy;", "\xd1\x8a" },
+	{ "yucy;", "\xd1\x8e" },
+	{ "ccupssm;", "\xe2\xa9\x90" },
+	{ "Upsi;", "\xcf\x92" },
+	{ "copy;", "\xc2\xa9" },
+	{ "RightTriangleBar;", "\xe2\xa7\x90" },
+	{ "subsup;", "\xe2\xab\x93" },
+	{ "siml;", "\xe2\xaa\x9d" },
+	{ "emsp13;", "\xe2\x80\x84" },
+	{ "Mu;", "\xce\x9c" },
+};
@@ -26,6 +26,8 @@
 #include <err.h>
 #endif
 #include <fcntl.h>
+#include <getopt.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -36,31 +38,138 @@
 void usage(void);
 int read_file(int fp, char **buf, size_t *buflen);
 int read_stdin(int fp, char **buf, size_t *buflen);
+static void add_query(char *, char *);
+static void read_rules(const char *);
+static void add_edit(int, const char *);
+
+static struct query *queries;
+static int nqueries;
+static struct edit *edits;
+static int nedits;
 
 extern char *__progname;
 
+#define OPT_STATS	256
+#define OPT_PERF	257
+#define OPT_CACHE	258
+#define OPT_INDEX	259
+#define OPT_VERIFY	260
+
+static const struct option longopts[] = {
+	{ "stats",	optional_argument,	NULL,	OPT_STATS },
+	{ "perf",	optional_argument,	NULL,	OPT_PERF },
+	{ "cache",	required_argument,	NULL,	OPT_CACHE },
+	{ "index",	required_argument,	NULL,	OPT_INDEX },
+	{ "index-verify",	no_argument,	NULL,	OPT_VERIFY },
+	{ NULL,		0,					NULL,	0 }
+};
+
 void
 usage(void)
 {
-	printf("%s: [-cdhpt] [-a attr_name[,attr_name [-f html_file] css_selector\n",__progname);
+	printf("%s: [-cdhpt] [-a attr_name[,attr_name] [-E charset] [-f html_file] [--stats[=json]] [--perf[=json]] [--cache=file] [--index=file [--index-verify]] css_selector\n",__progname);
+	printf("%s: [-cdhpt] [-a attr_name[,attr_name] [-E charset] [-f html_file] [--stats[=json]] [--perf[=json]] [--cache=file] [--index=file [--index-verify]] -e css_selector ... | -r rules_file\n",__progname);
+	printf("%s: [-w] [-s name=value] [-u name] [-T text] [-E charset] [-f html_file] css_selector | -e css_selector ... | -r rules_file\n",__progname);
 	exit(1);
 }
 
+/* a label of NULL leaves the output as it always was */
+static void
+add_query(char *label, char *str)
+{
+	struct query *q;
+
+	if ((q = reallocarray(queries, nqueries + 1, sizeof(*q))) == NULL)
+		err(1, "reallocarray");
+	queries = q;
+	q = &queries[nqueries++];
+	q->label = label;
+	q->str = str;
+}
+
+static void
+add_edit(int op, const char *arg)
+{
+	struct edit e, *ed;
+	int i;
+
+	edit_parse(&e, op, arg);
+	/* the last edit of an attribute or of the text is the one made */
+	for (i = 0; i < nedits; i++)
+		if (edit_same(&edits[i], &e)) {
+			edit_free(&edits[i]);
+			edits[i] = e;
+			return;
+		}
+	if ((ed = reallocarray(edits, nedits + 1, sizeof(*ed))) == NULL)
+		err(1, "reallocarray");
+	edits = ed;
+	edits[nedits++] = e;
+}
+
+/*
+ * one selector per line, optionally preceded by a label and a tab.
+ * Blank lines and lines starting with # are skipped.
+ */
+static void
+read_rules(const char *fname)
+{
+	FILE *f;
+	char *line = NULL, *p, *label, *str;
+	size_t sz = 0;
+	ssize_t len;
+
+	if ((f = fopen(fname, "r")) == NULL)
+		err(1, "%s", fname);
+	while ((len = getline(&line, &sz, f)) != -1) {
+		while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r'))
+			line[--len] = '\0';
+		if (len == 0 || line[0] == '#')
+			continue;
+		if ((p = strchr(line, '\t')) != NULL) {
+			*p++ = '\0';
+			label = strdup(line);
+			str = strdup(p);
+		} else {
+			label = strdup(line);
+			str = strdup(line);
+		}
+		if (label == NULL || str == NULL)
+			err(1, "strdup");
+		add_query(label, str);
+	}
+	if (ferror(f))
+		err(1, "%s", fname);
+	free(line);
+	fclose(f);
+}
+
 int
 main(int argc, char **argv)
 {
 	struct domhead dh;
-	struct selhead sh;
 	int ch, fd;
 	int flags=FLAG_NONE;
 	int rc=0;
 	char *fname = NULL;
-	char *selector = NULL;
 	char *attrname = NULL;
+	char *label, *str;
+	char *charset = NULL;
+	char *cache = NULL;
+	char *ixfile = NULL, *inraw = NULL;
+	size_t inlen = 0;
+	int ixrc = 1, ixverify = 0;
+	struct stat ixst;
+	uint64_t hash = 0;
 	char *raw = NULL;
 	size_t raw_len = 0;
+	int stats = 0;
+	int perf = 0;
+	int i, useset = 0;
+	uint16_t all = 0;
+	struct selset set;
 
-	while ((ch = getopt(argc, argv, "a:cdf:hptx")) != -1 ) {
+	while ((ch = getopt_long(argc, argv, "a:cde:E:f:hpr:s:tT:u:wx", longopts, NULL)) != -1 ) {
 		switch (ch) {
 			case 'a':
 				flags |= FLAG_ATTR;
@@ -73,6 +182,15 @@ main(int argc, char **argv)
 			case 'd':
 				flags |= FLAG_DEL;
 				break;
+			case 'e':
+				if ((label = strdup(optarg)) == NULL ||
+				    (str = strdup(optarg)) == NULL)
+					errx(1, "strdup");
+				add_query(label, str);
+				break;
+			case 'E':
+				charset = optarg;
+				break;
 			case 'f':
 				if ((fname = strdup(optarg)) == NULL)
 					errx(1, "strdup");
@@ -80,12 +198,52 @@ main(int argc, char **argv)
 			case 'p':
 				flags |= FLAG_PRETTY;
 				break;
+			case 'r':
+				read_rules(optarg);
+				break;
+			case 's':
+				add_edit(EDIT_SET, optarg);
+				break;
 			case 't':
 				flags |= FLAG_TEXT;
 				break;
+			case 'T':
+				add_edit(EDIT_TEXT, optarg);
+				break;
+			case 'u':
+				add_edit(EDIT_UNSET, optarg);
+				break;
+			case 'w':
+				add_edit(EDIT_UNWRAP, NULL);
+				break;
 			case 'x':
 				flags |= FLAG_X;
 				break;
+			case OPT_STATS:
+				if (optarg == NULL)
+					stats = 1;
+				else if (strcmp(optarg, "json") == 0)
+					stats = 2;
+				else
+					usage();
+				break;
+			case OPT_CACHE:
+				cache = optarg;
+				break;
+			case OPT_INDEX:
+				ixfile = optarg;
+				break;
+			case OPT_VERIFY:
+				ixverify = 1;
+				break;
+			case OPT_PERF:
+				if (optarg == NULL)
+					perf = 1;
+				else if (strcmp(optarg, "json") == 0)
+					perf = 2;
+				else
+					usage();
+				break;
 			case 'h':
 			default:
 				usage();
@@ -94,49 +252,135 @@ main(int argc, char **argv)
 	}
 	argc -= optind;
 	argv += optind;
-	if (argc < 1) {
+	if (nqueries == 0) {
+		if (argc != 1)
+			usage();
+		if ((str = strdup(argv[0])) == NULL)
+			err(1, "strdup");
+		add_query(NULL, str);
+	} else if (argc != 0)
 		usage();
+	if (nedits != 0) {
+		/* the edits are made to the input, not printed from the dom */
+		if (flags & (FLAG_ALL|FLAG_PRETTY|FLAG_DEL|FLAG_ATTR|FLAG_X))
+			usage();
+		flags |= FLAG_EDIT;
+	}
+	/* -d and edits need the union, see selset.c, the others a bit each */
+	if ((flags & (FLAG_DEL|FLAG_EDIT)) && queries[0].label != NULL)
+		useset = 1;
+	else if (nqueries > QUERY_MAX)
+		errx(1, "more than %d selectors without -d or edits", QUERY_MAX);
+
+	if (perf)
+		perf_open();
+	/* queries no longer moves, the heads can be set up in place */
+	stats_start(PHASE_SEL);
+	selset_init(&set);
+	for (i = 0; i < nqueries; i++) {
+		TAILQ_INIT(&queries[i].sh);
+		if (parse_sel(&queries[i].sh, queries[i].str) != 0) {
+			if (queries[i].label != NULL)
+				errx(1, "bad selector %s", queries[i].str);
+			errx(1,"bad selector");
+		}
+		if (useset)
+			selset_add(&set, &queries[i].sh);
+		else
+			all |= QUERY_BIT(i);
 	}
-	if ((selector = strdup(argv[0])) == NULL)
-		err(1, "strdup");
-	
+	stats_stop(PHASE_SEL);
+
+	if (flags & FLAG_X) {
+		for (i = 0; i < nqueries; i++) {
+			printf("selector: ");
+			print_sel(&queries[i].sh);
+		}
+	}
+
+	/* an index may answer without reading all of the input */
+	if (ixfile != NULL && fname != NULL && charset == NULL &&
+	    (ixrc = idx_query(ixfile, fname, queries, nqueries, flags,
+	    attrname, ixverify)) == 0) {
+		memset(&dh, 0, sizeof(dh));
+		goto done;
+	}
+
+	stats_start(PHASE_READ);
 	if (fname == NULL) {
 		fd = STDIN_FILENO;
 		read_stdin(fd, &raw, &raw_len);
 	} else {
 		if ((fd = open(fname, O_RDONLY)) == -1)
 			err(1,"open");
+		/* an index is of the file as it was before it was read */
+		if (ixfile != NULL && fstat(fd, &ixst) == -1)
+			err(1, "fstat");
 		read_file(fd, &raw, &raw_len);
 		close(fd);
 	}
-	
-	TAILQ_INIT(&dh);
-	TAILQ_INIT(&sh);
-
-	rc = parse_sel(&sh, selector);
-	if (rc != 0)
-		errx(1,"bad selector");
-	if (selector)
-		free(selector);
+	inraw = raw;
+	inlen = raw_len;
+	input_utf8(&raw, &raw_len, charset);
+	stats_stop(PHASE_READ);
 
-	if (flags & FLAG_X) {
-		printf("selector: ");
-		print_sel(&sh);
+	stats_start(PHASE_PARSE);
+	if (cache != NULL)
+		hash = snap_hash(raw, raw_len);
+	if (cache == NULL || snap_load(&dh, cache, raw, raw_len, hash) != 0) {
+		rc = parse_dom(&dh, raw, raw_len);
+		if (cache != NULL && rc == 0)
+			snap_save(&dh, cache, hash);
+	}
+	stats_stop(PHASE_PARSE);
+	/* offsets in the index are those of the file, less a BOM */
+	if (ixrc == -1 && rc == 0) {
+		if (raw == inraw)
+			idx_save(&dh, ixfile, fname, inlen - raw_len, &ixst);
+		else
+			warnx("%s: not UTF-8, not indexed", fname);
 	}
-
-	rc = parse_dom(&dh, raw, raw_len);
 	if (rc != 0)
 		errx(1,"file parse errors");
-	if (raw)
-		free(raw);
 
-	rc = modify_dom(&dh, &sh, flags);
+	stats_start(PHASE_MATCH);
+	if (useset) {
+		rc = selset_match(&dh, &set, QUERY_BIT(0));
+		all = QUERY_BIT(0);
+	} else
+		rc = modify_queries(&dh, queries, nqueries, flags);
+	stats_stop(PHASE_MATCH);
 	if (rc != 0)
 		errx(1,"modify errors");
 
-	print_dom(&dh, flags, attrname);
+	stats_start(PHASE_PRINT);
+	/* -d, -x and edits show the whole document once */
+	if (flags & FLAG_EDIT)
+		print_edits(&dh, edits, nedits, all);
+	else if (flags & (FLAG_DEL|FLAG_X))
+		print_query(&dh, flags, attrname, all, NULL);
+	else {
+		for (i = 0; i < nqueries; i++)
+			print_query(&dh, flags, attrname, QUERY_BIT(i),
+			    queries[i].label);
+	}
+	fflush(stdout);
+	stats_stop(PHASE_PRINT);
+done:
+	if (stats) {
+		stats_count(&dh, raw_len);
+		stats_print(stderr, stats == 2);
+	}
+	if (perf_enabled)
+		perf_print(stderr, raw_len, perf == 2);
 	if (attrname)
 		free(attrname);
+	for (i = 0; i < nedits; i++)
+		edit_free(&edits[i]);
+	free(edits);
+	/* the dom points into raw */
+	if (raw)
+		free(raw);
 //	free_dom(&dh);
 //	free_sel(&sh);
 	return(0);
@@ -155,6 +399,7 @@ read_file(int fp, char **buf, size_t *buflen)
 	if ((*buf = calloc(*buflen+1,sizeof(char))) == NULL) {
 		err(1,"calloc");
 	}
+	alloc_bytes += *buflen+1;
 	rlen = read(fp, *buf, *buflen);
 	if ((size_t)rlen != *buflen)
 		warnx("file read error: read: %ld, expected: %ld", rlen, *buflen);
@@ -185,7 +430,8 @@ read_stdin(int fp, char **buf, size_t *buflen)
 			free(*buf);
 			err(1,"realloc");
 	}
-	p[off+1] = '\0';
+	p[off] = '\0';
+	alloc_bytes += off+1;
 	*buf = p;
 	*buflen = off;
 	return(0);
@@ -6,10 +6,23 @@
 #define fatal(a...)	errx(1,a)
 
 // dom structure
+/*
+ * The document is kept as flat arrays.  Nodes are stored in document
+ * (preorder) order and linked by 32 bit indices, index 0 is the root that
+ * holds the top level nodes so 0 also serves as "none" for child and
+ * sibling links.  Names, values and text are spans into the source buffer,
+ * which the dom keeps.
+ */
+struct span {
+	uint32_t				off;
+	uint32_t				len;
+};
+
+/* an attribute without a value has value.off == 0 */
 struct attr_elem {
-	char *					key;
-	char *					value;
-	TAILQ_ENTRY(attr_elem)	next;
+	struct span				key;
+	struct span				value;
+	uint32_t				katom;		/* of key, see dom_atoms() */
 };
 
 enum {
@@ -17,6 +30,7 @@ enum {
 	DOMF_ELEM,
 	DOMF_TEXT,
 	DOMF_COMM,
+	DOMF_ROOT,
 };
 
 extern const char *elem_type_str[];
@@ -25,21 +39,105 @@ extern const char *sel_op_str[];
 #define ELEM_INLINE		0x01
 #define ELEM_NOEND		0x02
 
-TAILQ_HEAD(domhead, dom_elem);
+/*
+ * what only the root and the elements need, kept aside so text and
+ * comment nodes stay small.  Their info is 0, an entry left empty.
+ */
+struct elem_info {
+	uint32_t				prev_el;	/* element siblings */
+	uint32_t				next_el;
+	uint32_t				pos;		/* among the element siblings, from 1 */
+	uint32_t				cls;		/* class atoms, see atom.c */
+	uint32_t				ncls;
+	uint32_t				aidx;		/* attributes by name, if wide */
+	uint32_t				tpos;		/* among those of the same name */
+	uint32_t				ntype;		/* siblings of the same name */
+	uint32_t				nel;		/* element children */
+	uint32_t				etag;		/* name in its end tag, 0 if none */
+};
+
 struct dom_elem {
-	uint8_t					match;
+	uint16_t				match;		/* a bit per query, see QUERY_BIT */
 	uint8_t					type;
-	int						flags;
-	char *					name;
-	char *					value;
-	int						line;
-	struct dom_elem			*parent;
-	TAILQ_HEAD(,attr_elem)	attrs;
-	TAILQ_HEAD(,dom_elem)	children;
-	TAILQ_ENTRY(dom_elem)	next;
-	struct domhead			*head;
+	uint8_t					flags;
+	uint32_t				line;
+	uint32_t				parent;
+	uint32_t				child;		/* first child */
+	uint32_t				next;		/* next sibling */
+	uint32_t				end;		/* last node of the subtree */
+	uint32_t				info;		/* see struct elem_info */
+	uint32_t				attr;		/* first attribute */
+	uint32_t				nattr;
+	struct span				name;
+	struct span				value;
+};
+
+/* a distinct name, the string is in the source or a decoded value */
+struct atom {
+	const char				*str;
+	uint32_t				len;
+	uint32_t				hash;
 };
 
+#define ATOM_NONE			UINT32_MAX
+
+struct domhead {
+	char					*raw;		/* source, not owned */
+	size_t					rawlen;
+	struct dom_elem			*elems;
+	uint32_t				nelems;
+	uint32_t				elemsz;
+	struct attr_elem		*attrs;
+	uint32_t				nattrs;
+	uint32_t				attrsz;
+	struct elem_info		*info;
+	uint32_t				ninfo;
+	uint32_t				infosz;
+	char					**dtext;	/* decoded text, see text_value() */
+	char					**dattr;	/* decoded values, see attr_value() */
+	struct atom				*atoms;
+	uint32_t				natoms;
+	uint32_t				atomsz;
+	uint32_t				*aslots;	/* hash of atoms + 1, 0 is empty */
+	uint32_t				nslots;
+	uint32_t				*cls;		/* sorted atoms of each element */
+	uint32_t				ncls;
+	uint32_t				clssz;
+	uint32_t				*aidx;		/* attribute indices by katom */
+	uint32_t				naidx;
+	uint32_t				aidxsz;
+	uint32_t				class_atom;
+	char					*text;		/* all text, see dom_text() */
+	uint32_t				ntext;
+	uint32_t				*toff;		/* by node, into text */
+	uint32_t				*mlist;		/* matched nodes, see match_add() */
+	uint32_t				nmlist;
+	uint32_t				mlistsz;
+	char					*map;		/* of a snapshot, see snap.c */
+	size_t					mapsz;
+};
+
+/* elements with more attributes are searched by sorted name */
+#define ATTR_WIDE			8
+
+#define DOM_ROOT			0
+#define DOM_NODE(_dh,_i)	(&(_dh)->elems[(_i)])
+#define DOM_IDX(_dh,_e)		((uint32_t)((_e) - (_dh)->elems))
+#define DOM_STR(_dh,_s)		((_dh)->raw + (_s).off)
+/* node _i is a descendant of node _a, the subtree of _a is _a + 1 .. end */
+#define DOM_INSIDE(_dh,_i,_a) \
+	((_a) < (_i) && (_i) <= DOM_NODE(_dh, _a)->end)
+#define DOM_INFO(_dh,_e)	(&(_dh)->info[(_e)->info])
+#define DOM_ATTR(_dh,_e,_n)	(&(_dh)->attrs[(_e)->attr + (_n)])
+
+#define DOM_FOREACH_CHILD(_c,_dh,_e) \
+	for ((_c) = (_e)->child ? DOM_NODE(_dh, (_e)->child) : NULL; \
+	    (_c) != NULL; \
+	    (_c) = (_c)->next ? DOM_NODE(_dh, (_c)->next) : NULL)
+#define DOM_FOREACH_ATTR(_a,_dh,_e) \
+	for ((_a) = DOM_ATTR(_dh, _e, 0); \
+	    (_a) < DOM_ATTR(_dh, _e, (_e)->nattr); (_a)++)
+
 #define FLAG_TEXT			0x0001
 #define FLAG_COMMENT		0x0002
 #define FLAG_ELEM			0x0004
@@ -48,11 +146,29 @@ struct dom_elem {
 #define FLAG_PRETTY			0x0200
 #define FLAG_DEL			0x0400
 #define FLAG_ATTR			0x0800
+#define FLAG_EDIT			0x1000
 #define FLAG_X				0x8000
 #define FLAG_ALL			0x00ff
 #define NOT_FLAG(f)			(FLAG_ALL^(f))
 
 
+/* phases timed by --stats */
+enum {
+	PHASE_READ,
+	PHASE_SEL,
+	PHASE_PARSE,
+	PHASE_MATCH,
+	PHASE_PRINT,
+	PHASE_MAX
+};
+
+/* input encodings */
+enum {
+	ENC_AUTO,
+	ENC_UTF8,
+	ENC_CP1252
+};
+
 /* attribute OPs */
 enum {
 	OP_MATCH,
@@ -61,7 +177,8 @@ enum {
 	OP_EQ_START,
 	OP_START,
 	OP_END,
-	OP_SUBSTR
+	OP_SUBSTR,
+	OP_REGEX
 };
 
 /* element OPs */
@@ -75,39 +192,238 @@ enum {
 	EOP_PRECED
 };
 
+struct sel_re;				/* see rx.c */
+
 struct sel_attr {
 	int	op;
 	char *name;
 	char *val;
+	uint32_t katom;		/* of name, see sel_atoms() */
+	uint32_t atom;		/* of val for class~= */
+	char *needle;		/* val case folded, see sel_compile() */
+	size_t nlen;
+	struct sel_re *re;	/* of =~ */
+	int flags;
 	TAILQ_ENTRY(sel_attr) next;
 };
+#define SATTR_CASE		0x01	/* [a=v s], compare exactly */
+
+enum {
+	PS_NTH_CHILD,
+	PS_NTH_LAST_CHILD,
+	PS_NTH_OF_TYPE,
+	PS_NTH_LAST_OF_TYPE,
+	PS_ONLY_CHILD,
+	PS_ONLY_OF_TYPE,
+	PS_ROOT,
+	PS_EMPTY,
+	PS_HAS,
+	PS_IS,				/* and :where() */
+	PS_NOT,
+	PS_CONTAINS,
+	PS_CONTAINS_RE
+};
+
+/* a pseudo-class, :first-child is :nth-child(1) */
+struct sel_pseudo {
+	int type;
+	char *name;			/* as written, for print_sel() */
+	char *arg;
+	int a;				/* an+b of the :nth ones */
+	int b;
+	int rel;			/* EOP_* of :has(), descendants by default */
+	struct selhead *sub;	/* the selector in ( ) */
+	uint8_t *memo;		/* by node, see sel_prepare() */
+	uint32_t nmemo;
+	struct rule *alts;	/* of :is() and :not(), see sel_compile() */
+	uint32_t nalts;
+	char *needle;		/* of :contains(), case folded */
+	size_t nlen;
+	struct sel_re *re;	/* of :contains-re() */
+	uint32_t *hits;		/* its offsets in the text, see text_hits() */
+	uint32_t nhits;
+	uint32_t hitsz;
+	TAILQ_ENTRY(sel_pseudo) next;
+};
+
 struct sel {
 	char *elem;
 	int	op;
 	int has_class;
 	int has_id;
 	int has_attr;
+	uint32_t scope;			/* widest match so far, see match_sel() */
+	uint32_t *sibs;			/* match position by parent, see match_sel() */
+	uint32_t nsibs;
 	TAILQ_HEAD(,sel_attr)	attrs;
+	TAILQ_HEAD(,sel_pseudo)	pseudos;
 	TAILQ_ENTRY(sel) 		next;
 };
 
 TAILQ_HEAD(selhead, sel);
 
+/* one of several selectors run over the dom in the same pass */
+struct query {
+	char					*label;		/* prefixes its output records */
+	char					*str;
+	struct selhead			 sh;
+};
+
+/* a change made to the matched elements, see edit.c */
+enum {
+	EDIT_SET,							/* an attribute */
+	EDIT_UNSET,
+	EDIT_TEXT,							/* all inside the element */
+	EDIT_UNWRAP							/* the tags, not what is inside */
+};
+
+struct edit {
+	int						op;
+	char					*name;		/* of the attribute */
+	char					*str;		/* written as is */
+	size_t					 len;
+};
+
+#define QUERY_MAX			16			/* bits in dom_elem.match */
+#define QUERY_BIT(_q)		((uint16_t)(1U << (_q)))
+
+/* many selectors filed by a key of their rightmost compound, see selset.c */
+enum {
+	SKEY_ANY,
+	SKEY_ID,
+	SKEY_CLASS,
+	SKEY_ATTR,
+	SKEY_TAG
+};
+
+struct rule {
+	struct sel				*s;			/* rightmost compound */
+	struct sel				*left;		/* of the combinator or NULL */
+	uint32_t				next;		/* in the bucket, index + 1 */
+};
+
+struct rule_bucket {
+	const char				*key;		/* in the selector */
+	size_t					keylen;
+	uint32_t				hash;
+	int					kind;		/* SKEY_* */
+	uint32_t				first;		/* rule index + 1, 0 is empty */
+};
+
+struct selset {
+	struct selhead			**heads;
+	uint32_t				nheads;
+	uint32_t				headsz;
+	struct rule				*rules;
+	uint32_t				nrules;
+	uint32_t				rulesz;
+	struct rule_bucket		*slots;
+	uint32_t				nslots;
+	uint32_t				nkeys;
+	uint32_t				any;		/* rules without a key */
+	size_t					tests;		/* rules tried */
+};
+
+/* atom.c */
+void dom_atoms(struct domhead *);
+uint32_t atom_hash(const char *, size_t);
+uint32_t find_atom(struct domhead *, const char *);
+struct attr_elem *elem_attr(struct domhead *, struct dom_elem *, uint32_t);
+int has_class(struct domhead *, struct dom_elem *, uint32_t);
+int word_match(const char *, size_t, const char *, int);
+void sel_atoms(struct domhead *, struct selhead *);
+void free_atoms(struct domhead *);
+/* edit.c */
+void edit_parse(struct edit *, int, const char *);
+int edit_same(const struct edit *, const struct edit *);
+void edit_free(struct edit *);
+void print_edits(struct domhead *, struct edit *, int, uint16_t);
+void splice_add(uint32_t, uint32_t, const char *, size_t);
+void splice_write(struct domhead *);
+/* encoding.c */
+int input_utf8(char **, size_t *, const char *);
+int charset_enc(const char *);
+size_t utf8_valid(const char *, size_t);
+size_t put_utf8(char *, uint32_t);
+extern const uint16_t cp1252_c1[];
+/* entities.c */
+char *decode_entities(const char *, size_t, int);
+const char *attr_value(struct domhead *, struct attr_elem *, size_t *);
+const char *text_value(struct domhead *, struct dom_elem *, size_t *);
+void free_values(struct domhead *);
+void dom_text(struct domhead *);
 /* print.c */
 void print_dom(struct domhead*, int, char *);
+void print_query(struct domhead*, int, char *, uint16_t, const char *);
+void print_indent(int);
+void print_elem(struct domhead *, struct dom_elem *, int, int, char *);
 void print_sel(struct selhead *);
+/* idx.c */
+struct stat;
+void idx_save(struct domhead *, const char *, const char *, size_t,
+    struct stat *);
+int idx_query(const char *, const char *, struct query *, int, int,
+    char *, int);
 /* modify.c */
 int modify_dom(struct domhead *, struct selhead *, int);
+int modify_queries(struct domhead *, struct query *, int, int);
+int check_element(struct domhead *, struct dom_elem *, struct selhead *, int);
+int match_sel(struct domhead *, struct dom_elem *, struct selhead *, int);
+int sel_bare(struct selhead *);
+int match_compound(struct domhead *, struct dom_elem *, struct sel *);
+int match_rel(struct domhead *, struct dom_elem *, struct sel *, struct sel *);
+void match_clear(struct domhead *);
+void match_add(struct domhead *, uint32_t);
+int sel_compile(struct selhead *);
+const char *needle_find(const char *, size_t, const char *, size_t, int);
+struct sel_pseudo *sel_bare_is(struct sel *);
+void sel_prepare(struct domhead *, struct selhead *);
 /* parse.y */
 int parse_dom(struct domhead*, char *, size_t);
+size_t lex_dom(char *, size_t);
+/* rx.c */
+struct sel_re *rx_compile(const char *, int);
+const char *rx_lit(struct sel_re *, size_t *);
+int rx_exec(struct sel_re *, const char *, size_t);
+int rx_match(struct sel_re *, const char *, size_t);
+void rx_free(struct sel_re *);
+/* selset.c */
+void selset_init(struct selset *);
+void selset_add(struct selset *, struct selhead *);
+int selset_match(struct domhead *, struct selset *, uint16_t);
+void selset_free(struct selset *);
 /* selector.y */
 int parse_sel(struct selhead *, char *);
 
+/* snap.c */
+uint64_t snap_hash(const char *, size_t);
+void snap_save(struct domhead *, const char *, uint64_t);
+int snap_load(struct domhead *, const char *, char *, size_t, uint64_t);
+void snap_free(struct domhead *);
+/* stats.c */
+void stats_start(int);
+void stats_stop(int);
+void stats_count(struct domhead *, size_t);
+void stats_print(FILE *, int);
+extern size_t alloc_bytes;
+extern const char *phase_str[];
+/* perf.c */
+int perf_open(void);
+void perf_start(int);
+void perf_stop(int);
+void perf_print(FILE *, size_t, int);
+extern int perf_enabled;
 /* utils.c */
-struct dom_elem *alloc_elem(void);
-struct attr_elem *alloc_attr(void);
+uint32_t alloc_elem(struct domhead *);
+uint32_t alloc_attr(struct domhead *);
+uint32_t alloc_info(struct domhead *);
+void free_dom(struct domhead *);
 struct sel *alloc_sel(void);
 struct sel_attr *alloc_sel_attr(void);
+struct sel_pseudo *alloc_sel_pseudo(void);
+void free_sel_pseudo(struct sel_pseudo *);
+void free_sel(struct selhead *);
+void reset_sel(struct selhead *);
 struct sel_attr *find_attr(struct sel *, char *);
 int is_top(struct dom_elem *);
 char *extract_str(char *, char *);
@@ -118,9 +434,14 @@ int peek_back(void);
 int yyerror(const char *, ...)
 	__attribute__((__format__ (printf, 1, 2)))
 	__attribute__((__nonnull__ (1)));
-int unterminated_element(char *elem);
-struct dom_elem *next_elem(struct dom_elem *);
-struct dom_elem *prev_elem(struct dom_elem *);
+int void_element(const char *, size_t);
+int span_strcasecmp(struct domhead *, struct span, const char *);
+void node_span(struct domhead *, struct dom_elem *, struct span *,
+    struct span *);
+uint32_t node_end(struct domhead *, struct dom_elem *);
+int span_casecmp(struct domhead *, struct span, struct span);
+struct dom_elem *next_elem(struct domhead *, struct dom_elem *);
+struct dom_elem *prev_elem(struct domhead *, struct dom_elem *);
 char *clean_str(char *);
 
 extern int errors;
@@ -0,0 +1,506 @@
+/* $Id$ */
+/*
+ * Copyright (c) 2024 Michael Graves
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * an index kept beside a document: where in the file every element
+ * starts and ends, filed by its id, classes and name.  A selector whose
+ * compounds each need one of those and only look inside the element is
+ * run over just the elements the index gives, each parsed on its own,
+ * so a large file is not parsed as a whole.  The index is made by a run
+ * that parses all of the document.  It is used while the document has
+ * the size, modification time, inode and device it had then; a hash of
+ * the document is kept as well, checked only when asked to.
+ */
+
+#include "config.h"
+
+#if HAVE_SYS_QUEUE
+#include <sys/queue.h>
+#endif
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#if HAVE_ERR
+#include <err.h>
+#endif
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+
+#include "hq.h"
+
+#define IDX_MAGIC		"hqidx\0\0\0"
+#define IDX_VERSION		3
+
+struct idx_hdr {
+	char		magic[8];
+	uint32_t	version;
+	uint32_t	base;		/* bytes before the first offset, a BOM */
+	uint64_t	size;		/* of the document */
+	int64_t		mtime;		/* and its modification time */
+	int64_t		mtime_ns;
+	uint64_t	ino;
+	uint64_t	dev;
+	uint64_t	hash;		/* of the document less base, snap_hash() */
+	uint32_t	nslots;
+	uint32_t	nents;
+	uint32_t	npool;
+	uint32_t	pad;
+};
+
+/* a hash table of the keys, a slot with no entries is empty */
+struct idx_key {
+	uint32_t	hash;
+	uint32_t	kind;		/* SKEY_* */
+	uint32_t	off;		/* into the pool */
+	uint32_t	len;
+	uint32_t	first;		/* its elements in document order */
+	uint32_t	n;
+};
+
+/* an element from its start tag to the end of its subtree */
+struct idx_ent {
+	uint32_t	start;
+	uint32_t	end;
+	uint32_t	depth;		/* its ancestors, for -p */
+};
+
+/* a key of an element while the index is made */
+struct idx_rec {
+	uint32_t	kind;
+	uint32_t	hash;
+	const char	*str;
+	uint32_t	len;
+	struct idx_ent ent;
+};
+
+static int idx_same(struct idx_hdr *, struct stat *);
+static char *doc_map(const char *, struct stat *);
+static int rec_cmp(const void *, const void *);
+static int rec_same(struct idx_rec *, struct idx_rec *);
+static int ent_cmp(const void *, const void *);
+static void rec_add(int, const char *, size_t, struct idx_ent *);
+static int idx_key(struct sel *, const char **);
+static struct idx_key *key_find(struct idx_hdr *, int, const char *, size_t);
+
+static struct idx_rec *recs;
+static uint32_t nrecs, recsz;
+
+/* st is the document hd was made from, as far as stat can tell */
+static int
+idx_same(struct idx_hdr *hd, struct stat *st)
+{
+	return(hd->size == (uint64_t)st->st_size &&
+	    hd->mtime == (int64_t)st->st_mtim.tv_sec &&
+	    hd->mtime_ns == (int64_t)st->st_mtim.tv_nsec &&
+	    hd->ino == (uint64_t)st->st_ino && hd->dev == (uint64_t)st->st_dev);
+}
+
+static int
+rec_cmp(const void *a, const void *b)
+{
+	const struct idx_rec *x = a, *y = b;
+	int c;
+
+	if (x->kind != y->kind)
+		return(x->kind < y->kind ? -1 : 1);
+	if (x->hash != y->hash)
+		return(x->hash < y->hash ? -1 : 1);
+	if (x->len != y->len)
+		return(x->len < y->len ? -1 : 1);
+	if ((c = strncasecmp(x->str, y->str, x->len)) != 0)
+		return(c);
+	return(x->ent.start < y->ent.start ? -1 : x->ent.start > y->ent.start);
+}
+
+/* x and y are filed under one key */
+static int
+rec_same(struct idx_rec *x, struct idx_rec *y)
+{
+	return(x->kind == y->kind && x->len == y->len &&
+	    strncasecmp(x->str, y->str, x->len) == 0);
+}
+
+static int
+ent_cmp(const void *a, const void *b)
+{
+	const struct idx_ent *x = a, *y = b;
+
+	if (x->start != y->start)
+		return(x->start < y->start ? -1 : 1);
+	/* the outer of two at one place first */
+	return(x->end > y->end ? -1 : x->end < y->end);
+}
+
+static void
+rec_add(int kind, const char *str, size_t len, struct idx_ent *ent)
+{
+	struct idx_rec *r;
+	uint32_t n;
+
+	if (nrecs == recsz) {
+		n = recsz ? recsz * 2 : 1024;
+		if ((r = reallocarray(recs, n, sizeof(*r))) == NULL)
+			err(1, "reallocarray");
+		recs = r;
+		recsz = n;
+	}
+	r = &recs[nrecs++];
+	r->kind = kind;
+	r->hash = atom_hash(str, len);
+	r->str = str;
+	r->len = len;
+	r->ent = *ent;
+}
+
+/*
+ * write the index of dh, the document in fname, to path.  The offsets in
+ * the file are base more than those in dh, and sb is the stat of fname
+ * before it was read.  A failure only warns.
+ */
+void
+idx_save(struct domhead *dh, const char *path, const char *fname,
+    size_t base, struct stat *sb)
+{
+	struct idx_hdr hd;
+	struct idx_key *slots = NULL, *k;
+	struct idx_ent *ents = NULL, ent;
+	struct dom_elem *e;
+	struct elem_info *x;
+	struct attr_elem *a;
+	struct span tag, etag;
+	struct stat st;
+	uint32_t i, j, n, id, npool = 0, mask, *depth;
+	const char *v;
+	char *tmp, *pool = NULL;
+	size_t len;
+	FILE *f;
+	int fd;
+
+	if (stat(fname, &st) == -1 ||
+	    (size_t)st.st_size != dh->rawlen + base) {
+		warnx("%s: changed while read, not indexed", fname);
+		return;
+	}
+	memcpy(hd.magic, IDX_MAGIC, sizeof(hd.magic));
+	hd.size = st.st_size;
+	hd.mtime = st.st_mtim.tv_sec;
+	hd.mtime_ns = st.st_mtim.tv_nsec;
+	hd.ino = st.st_ino;
+	hd.dev = st.st_dev;
+	if (!idx_same(&hd, sb)) {
+		warnx("%s: changed while read, not indexed", fname);
+		return;
+	}
+	/* a parent comes before its children */
+	if ((depth = calloc(dh->nelems, sizeof(*depth))) == NULL)
+		err(1, "calloc");
+	id = find_atom(dh, "id");
+	nrecs = 0;
+	for (i = 1; i < dh->nelems; i++) {
+		e = DOM_NODE(dh, i);
+		if (e->parent != DOM_ROOT)
+			depth[i] = depth[e->parent] + 1;
+		if (e->type != DOMF_ELEM)
+			continue;
+		node_span(dh, e, &tag, &etag);
+		ent.start = tag.off;
+		ent.end = node_end(dh, e);
+		ent.depth = depth[i];
+		rec_add(SKEY_TAG, DOM_STR(dh, e->name), e->name.len, &ent);
+		x = DOM_INFO(dh, e);
+		for (j = 0; j < x->ncls; j++)
+			rec_add(SKEY_CLASS, dh->atoms[dh->cls[x->cls + j]].str,
+			    dh->atoms[dh->cls[x->cls + j]].len, &ent);
+		DOM_FOREACH_ATTR(a, dh, e) {
+			if (a->katom == id &&
+			    (v = attr_value(dh, a, &len)) != NULL && len != 0)
+				rec_add(SKEY_ID, v, len, &ent);
+		}
+	}
+	free(depth);
+	if (nrecs > 1)
+		qsort(recs, nrecs, sizeof(*recs), rec_cmp);
+
+	/* a key for each run of records, its entries side by side */
+	for (i = n = 0; i < nrecs; i++) {
+		if (i == 0 || !rec_same(&recs[i - 1], &recs[i])) {
+			n++;
+			npool += recs[i].len;
+		}
+	}
+	for (hd.nslots = 16; hd.nslots < n * 2; hd.nslots *= 2)
+		;
+	mask = hd.nslots - 1;
+	if ((slots = calloc(hd.nslots, sizeof(*slots))) == NULL ||
+	    (ents = calloc(nrecs + 1, sizeof(*ents))) == NULL ||
+	    (pool = malloc(npool + 1)) == NULL)
+		err(1, "calloc");
+	for (i = 0, k = NULL, npool = 0; i < nrecs; i++) {
+		if (k == NULL || !rec_same(&recs[i - 1], &recs[i])) {
+			for (j = recs[i].hash & mask; slots[j].n != 0;
+			    j = (j + 1) & mask)
+				;
+			k = &slots[j];
+			k->hash = recs[i].hash;
+			k->kind = recs[i].kind;
+			k->off = npool;
+			k->len = recs[i].len;
+			k->first = i;
+			memcpy(pool + npool, recs[i].str, recs[i].len);
+			npool += recs[i].len;
+		}
+		k->n++;
+		ents[i] = recs[i].ent;
+	}
+
+	hd.version = IDX_VERSION;
+	hd.base = base;
+	hd.hash = snap_hash(dh->raw, dh->rawlen);
+	hd.nents = nrecs;
+	hd.npool = npool;
+	hd.pad = 0;
+	if (asprintf(&tmp, "%s.XXXXXXXXXX", path) == -1)
+		err(1, "asprintf");
+	if ((fd = mkstemp(tmp)) == -1)
+		warn("%s", tmp);
+	else {
+		if ((f = fdopen(fd, "w")) == NULL)
+			err(1, "fdopen");
+		if (fwrite(&hd, sizeof(hd), 1, f) != 1 ||
+		    fwrite(slots, sizeof(*slots), hd.nslots, f) != hd.nslots ||
+		    fwrite(ents, sizeof(*ents), nrecs, f) != nrecs ||
+		    fwrite(pool, 1, npool, f) != npool)
+			err(1, "fwrite");
+		if (fclose(f) != 0) {
+			warn("%s", tmp);
+			unlink(tmp);
+		} else if (rename(tmp, path) == -1) {
+			warn("%s", path);
+			unlink(tmp);
+		}
+	}
+	free(tmp);
+	free(slots);
+	free(ents);
+	free(pool);
+	free(recs);
+	recs = NULL;
+	nrecs = recsz = 0;
+}
+
+/*
+ * the key of a compound the index has, by preference its id, a class or
+ * its name.  0 if there is none or the compound looks outside the
+ * element.
+ */
+static int
+idx_key(struct sel *s, const char **key)
+{
+	struct sel_attr *a;
+	struct sel_pseudo *p;
+	int kind = 0;
+
+	TAILQ_FOREACH(p, &s->pseudos, next) {
+		if (p->type != PS_CONTAINS && p->type != PS_CONTAINS_RE)
+			return(0);
+	}
+	TAILQ_FOREACH(a, &s->attrs, next) {
+		if (a->val == NULL || a->val[0] == '\0')
+			continue;
+		if (a->op == OP_EQ && strcasecmp(a->name, "id") == 0) {
+			*key = a->val;
+			return(SKEY_ID);
+		}
+		if (kind == 0 && a->op == OP_CONTAINS &&
+		    strcasecmp(a->name, "class") == 0) {
+			*key = a->val;
+			kind = SKEY_CLASS;
+		}
+	}
+	if (kind == 0 && s->elem[0] != '\0' && strcmp(s->elem, "*") != 0) {
+		*key = s->elem;
+		kind = SKEY_TAG;
+	}
+	return(kind);
+}
+
+static struct idx_key *
+key_find(struct idx_hdr *hd, int kind, const char *key, size_t len)
+{
+	struct idx_key *slots = (struct idx_key *)(hd + 1), *k;
+	const char *pool;
+	uint32_t h, i, mask = hd->nslots - 1;
+
+	pool = (const char *)hd + sizeof(*hd) +
+	    hd->nslots * sizeof(*slots) + hd->nents * sizeof(struct idx_ent);
+	h = atom_hash(key, len);
+	for (i = h & mask; slots[i].n != 0; i = (i + 1) & mask) {
+		k = &slots[i];
+		if (k->hash == h && k->kind == (uint32_t)kind &&
+		    k->len == len && strncasecmp(pool + k->off, key, len) == 0)
+			return(k);
+	}
+	return(NULL);
+}
+
+/* the document st is of, mapped, or NULL if it has since been replaced */
+static char *
+doc_map(const char *fname, struct stat *st)
+{
+	struct stat fst;
+	char *doc = NULL;
+	int fd;
+
+	stats_start(PHASE_READ);
+	if ((fd = open(fname, O_RDONLY)) == -1)
+		err(1, "open");
+	if (fstat(fd, &fst) == -1)
+		err(1, "fstat");
+	if (fst.st_size == st->st_size && fst.st_ino == st->st_ino &&
+	    fst.st_dev == st->st_dev) {
+		doc = mmap(NULL, st->st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (doc == MAP_FAILED)
+			err(1, "mmap");
+	}
+	close(fd);
+	stats_stop(PHASE_READ);
+	return(doc);
+}
+
+/*
+ * run q over the elements the index at path gives in the document fname
+ * and print them.  0 if it was, -1 if the index has to be made again and
+ * 1 if it cannot answer, the document is then parsed whole.  Only one
+ * query is run.  With verify the document is hashed as well, to see a
+ * change that stat does not.
+ */
+int
+idx_query(const char *path, const char *fname, struct query *q, int nq,
+    int flags, char *attr, int verify)
+{
+	struct idx_hdr *hd;
+	struct idx_key *k;
+	struct idx_ent *ents, *cand = NULL;
+	struct domhead dh;
+	struct stat st, dst;
+	struct sel *s;
+	const char *key;
+	char *map, *doc = NULL, *buf;
+	void *p;
+	uint32_t i, j, n = 0, end;
+	size_t sz;
+	int fd, kind, rc = 1;
+
+	if ((fd = open(path, O_RDONLY)) == -1)
+		return(-1);
+	if (fstat(fd, &st) == -1 || (size_t)st.st_size < sizeof(*hd)) {
+		close(fd);
+		return(-1);
+	}
+	sz = st.st_size;
+	map = mmap(NULL, sz, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+		return(-1);
+	hd = (struct idx_hdr *)map;
+	if (stat(fname, &dst) == -1 ||
+	    memcmp(hd->magic, IDX_MAGIC, sizeof(hd->magic)) != 0 ||
+	    hd->version != IDX_VERSION || !idx_same(hd, &dst) ||
+	    hd->base >= hd->size || hd->nslots == 0 ||
+	    (hd->nslots & (hd->nslots - 1)) != 0 ||
+	    sz != sizeof(*hd) + (uint64_t)hd->nslots * sizeof(*k) +
+	    (uint64_t)hd->nents * sizeof(*ents) + hd->npool) {
+		munmap(map, sz);
+		return(-1);
+	}
+	if (verify) {
+		if ((doc = doc_map(fname, &dst)) == NULL ||
+		    snap_hash(doc + hd->base, dst.st_size - hd->base) != hd->hash) {
+			rc = -1;
+			goto done;
+		}
+	}
+	ents = (struct idx_ent *)(map + sizeof(*hd) + hd->nslots * sizeof(*k));
+	if (nq != 1 || (flags & (FLAG_DEL|FLAG_EDIT|FLAG_X)))
+		goto done;
+	/* -t and -c with a bare * take all of the text */
+	if ((flags & (FLAG_TEXT|FLAG_COMMENT)) && sel_bare(&q->sh))
+		goto done;
+
+	/* the elements any of a, b may match */
+	TAILQ_FOREACH(s, &q->sh, next) {
+		if ((s->op != EOP_MATCH && s->op != EOP_ALL) ||
+		    (kind = idx_key(s, &key)) == 0)
+			goto done;
+		if ((k = key_find(hd, kind, key, strlen(key))) == NULL)
+			continue;
+		if (k->first > hd->nents || k->n > hd->nents - k->first)
+			goto done;
+		if ((p = reallocarray(cand, n + k->n, sizeof(*cand))) == NULL)
+			err(1, "reallocarray");
+		cand = p;
+		memcpy(cand + n, ents + k->first, k->n * sizeof(*cand));
+		n += k->n;
+	}
+	if (n > 1)
+		qsort(cand, n, sizeof(*cand), ent_cmp);
+	if (n != 0 && doc == NULL && (doc = doc_map(fname, &dst)) == NULL) {
+		rc = -1;
+		goto done;
+	}
+
+	/* one inside another is parsed with it */
+	for (i = 0, end = 0; i < n; i++) {
+		if (cand[i].start < end || cand[i].end <= cand[i].start ||
+		    hd->base + (uint64_t)cand[i].end > (uint64_t)dst.st_size)
+			continue;
+		end = cand[i].end;
+		j = end - cand[i].start;
+		stats_start(PHASE_READ);
+		if ((buf = malloc(j + 1)) == NULL)
+			err(1, "malloc");
+		memcpy(buf, doc + hd->base + cand[i].start, j);
+		buf[j] = '\0';
+		stats_stop(PHASE_READ);
+		stats_start(PHASE_PARSE);
+		if (parse_dom(&dh, buf, j) != 0)
+			errx(1, "file parse errors");
+		stats_stop(PHASE_PARSE);
+		stats_start(PHASE_MATCH);
+		modify_queries(&dh, q, 1, flags);
+		stats_stop(PHASE_MATCH);
+		stats_start(PHASE_PRINT);
+		print_indent(cand[i].depth);
+		print_query(&dh, flags, attr, QUERY_BIT(0), q->label);
+		print_indent(0);
+		stats_stop(PHASE_PRINT);
+		free_dom(&dh);
+		free(buf);
+	}
+	rc = 0;
+done:
+	free(cand);
+	if (doc != NULL)
+		munmap(doc, dst.st_size);
+	munmap(map, sz);
+	return(rc);
+}
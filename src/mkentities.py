@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+#
+# Generate entities.h: the HTML5 named character references with a
+# minimal perfect hash for lookup.  The entity list is the one shipped
+# with python (html.entities.html5, from the WHATWG entities.json).
+#
+#	python3 mkentities.py > entities.h
+#
+
+import html.entities
+import sys
+
+FNV_OFF = 2166136261
+FNV_PRIME = 16777619
+
+
+def fnv(seed, key):
+    h = (FNV_OFF ^ seed) & 0xffffffff
+    for c in key:
+        h ^= c
+        h = (h * FNV_PRIME) & 0xffffffff
+    return h
+
+
+def cstr(b):
+    return '"' + ''.join('\\x%02x' % c for c in b) + '"'
+
+
+def main():
+    ents = sorted(html.entities.html5.items())
+    keys = [k.encode() for k, v in ents]
+    n = len(keys)
+    nbuckets = n // 4
+    buckets = [[] for _ in range(nbuckets)]
+    for i, k in enumerate(keys):
+        buckets[fnv(0, k) % nbuckets].append(i)
+    order = sorted(range(nbuckets), key=lambda b: -len(buckets[b]))
+    disp = [0] * nbuckets
+    slots = [None] * n
+    for b in order:
+        if not buckets[b]:
+            continue
+        d = 1
+        while True:
+            pos = [fnv(d, keys[i]) % n for i in buckets[b]]
+            if len(set(pos)) == len(pos) and \
+                    all(slots[p] is None for p in pos):
+                break
+            d += 1
+        disp[b] = d
+        for i, p in zip(buckets[b], pos):
+            slots[p] = i
+
+    o = sys.stdout
+    o.write('/* generated by mkentities.py, do not edit */\n\n')
+    o.write('#define ENT_COUNT\t%d\n' % n)
+    o.write('#define ENT_BUCKETS\t%d\n\n' % nbuckets)
+    o.write('static const uint16_t ent_disp[ENT_BUCKETS] = {\n')
+    for i in range(0, nbuckets, 12):
+        o.write('\t' + ', '.join('%d' % d for d in disp[i:i+12]) + ',\n')
+    o.write('};\n\n')
+    o.write('static const struct entity ent_tab[ENT_COUNT] = {\n')
+    for p in range(n):
+        k, v = ents[slots[p]]
+        o.write('\t{ "%s", %s },\n' % (k, cstr(v.encode())))
+    o.write('};\n')
+
+
+if __name__ == '__main__':
+    main()
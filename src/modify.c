@@ -24,6 +24,7 @@
 #if HAVE_ERR
 #include <err.h>
 #endif
+#include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -31,34 +32,107 @@
 
 #include "hq.h"
 
-int check_element(struct dom_elem *e, struct selhead *sh, int);
-int match_sel(struct dom_elem *e, struct selhead *sh, int);
+static int match_query(struct domhead *, struct dom_elem *, struct selhead *,
+    int, uint16_t);
+static void mlist_grow(struct domhead *);
 
+/*
+ * the nodes are stored in document order so a single pass sees every
+ * parent before its children.  match_sel() depends on this, see
+ * reset_sel().
+ */
 int
 modify_dom(struct domhead *dh, struct selhead *sh, int f)
+{
+	uint32_t i;
+
+	reset_sel(sh);
+	sel_prepare(dh, sh);
+	match_clear(dh);
+	for (i = 1; i < dh->nelems; i++) {
+		if (match_sel(dh, DOM_NODE(dh, i), sh, f) == 1) {
+			DOM_NODE(dh, i)->match = 1;
+			match_add(dh, i);
+		}
+	}
+	return(0);
+}
+
+/*
+ * the same pass for several queries, each node is visited once and every
+ * query that matches it sets its bit in match.
+ */
+int
+modify_queries(struct domhead *dh, struct query *q, int nq, int f)
 {
 	struct dom_elem *e;
-	TAILQ_FOREACH(e, dh, next) {
-		/* don't do anything with the return value */
-		check_element(e, sh, f);
+	uint32_t i;
+	int j;
+
+	for (j = 0; j < nq; j++) {
+		reset_sel(&q[j].sh);
+		sel_prepare(dh, &q[j].sh);
+	}
+	match_clear(dh);
+	for (i = 1; i < dh->nelems; i++) {
+		e = DOM_NODE(dh, i);
+		for (j = 0; j < nq; j++) {
+			if (match_query(dh, e, &q[j].sh, f, QUERY_BIT(j)) == 1)
+				e->match |= QUERY_BIT(j);
+		}
+		if (e->match != 0)
+			match_add(dh, i);
 	}
 	return(0);
 }
 
+/*
+ * the matched nodes in document order, so printing visits those and not
+ * the whole dom.  The matchers clear it and add each node they match.
+ */
+void
+match_clear(struct domhead *dh)
+{
+	dh->nmlist = 0;
+	if (dh->mlist == NULL)
+		mlist_grow(dh);
+}
+
+void
+match_add(struct domhead *dh, uint32_t i)
+{
+	if (dh->nmlist == dh->mlistsz)
+		mlist_grow(dh);
+	dh->mlist[dh->nmlist++] = i;
+}
+
+static void
+mlist_grow(struct domhead *dh)
+{
+	uint32_t *p, n;
+
+	n = dh->mlistsz ? dh->mlistsz * 2 : 256;
+	if ((p = reallocarray(dh->mlist, n, sizeof(*p))) == NULL)
+		err(1, "reallocarray");
+	alloc_bytes += (n - dh->mlistsz) * sizeof(*p);
+	dh->mlist = p;
+	dh->mlistsz = n;
+}
+
 
 /* recurse */
 int
-check_element(struct dom_elem *e, struct selhead *sh, int f)
+check_element(struct domhead *dh, struct dom_elem *e, struct selhead *sh, int f)
 {
 	struct dom_elem *c;
 	int rc = 0;
 	// check to see e matches
-	if ( match_sel(e, sh, f) == 1) {
+	if ( match_sel(dh, e, sh, f) == 1) {
 		e->match = 1;
 		rc++;
 	}
-	TAILQ_FOREACH(c, &e->children, next) {
-		rc += check_element(c, sh, f);
+	DOM_FOREACH_CHILD(c, dh, e) {
+		rc += check_element(dh, c, sh, f);
 	}
 	return(rc);
 }
@@ -75,29 +149,737 @@ check_element(struct dom_elem *e, struct selhead *sh, int f)
  * selection EOP_* criteria.
  *
  */
-#define MATCH_NAME(_sn,_en) \
-		((strcmp("*",_sn) == 0) || (strcasecmp(_sn, _en) == 0))
+#define FOLD(_c)		((_c) >= 'A' && (_c) <= 'Z' ? (_c) | 0x20 : (_c))
+#define ONES			0x0101010101010101ULL
+#define HIGHS			0x8080808080808080ULL
+#define HAS_ZERO(_w)	(((_w) - ONES) & ~(_w) & HIGHS)
+
+static int
+str_eq(const char *a, const char *b)
+{
+	if (a == NULL || b == NULL)
+		return(a == b);
+	return(strcmp(a, b) == 0);
+}
+
+static int
+attr_eq(struct sel_attr *a, struct sel_attr *b)
+{
+	return(a->op == b->op && a->flags == b->flags &&
+	    strcasecmp(a->name, b->name) == 0 && str_eq(a->val, b->val));
+}
+
+/* the same compound, the combinator to its left aside */
+static int
+compound_eq(struct sel *a, struct sel *b)
+{
+	struct sel_attr *x, *y;
+	struct sel_pseudo *p, *q;
+
+	if (a == NULL || b == NULL)
+		return(a == b);
+	if (strcasecmp(a->elem, b->elem) != 0)
+		return(0);
+	for (x = TAILQ_FIRST(&a->attrs), y = TAILQ_FIRST(&b->attrs);
+	    x != NULL && y != NULL;
+	    x = TAILQ_NEXT(x, next), y = TAILQ_NEXT(y, next)) {
+		if (!attr_eq(x, y))
+			return(0);
+	}
+	if (x != NULL || y != NULL)
+		return(0);
+	for (p = TAILQ_FIRST(&a->pseudos), q = TAILQ_FIRST(&b->pseudos);
+	    p != NULL && q != NULL;
+	    p = TAILQ_NEXT(p, next), q = TAILQ_NEXT(q, next)) {
+		if (p->type != q->type || p->a != q->a || p->b != q->b ||
+		    !str_eq(p->arg, q->arg))
+			return(0);
+	}
+	return(p == NULL && q == NULL);
+}
+
+/* the :is() of a compound that is nothing else, as in ":is(a, b) p" */
+struct sel_pseudo *
+sel_bare_is(struct sel *s)
+{
+	struct sel_pseudo *p;
+
+	if (strcmp(s->elem, "*") != 0 || !TAILQ_EMPTY(&s->attrs) ||
+	    (p = TAILQ_FIRST(&s->pseudos)) == NULL ||
+	    TAILQ_NEXT(p, next) != NULL || p->type != PS_IS || p->alts == NULL)
+		return(NULL);
+	return(p);
+}
+
+static void
+alt_add(struct sel_pseudo *p, struct sel *s, struct sel *left)
+{
+	struct rule *r;
+	uint32_t i;
+
+	for (i = 0; i < p->nalts; i++) {
+		r = &p->alts[i];
+		if (compound_eq(r->s, s) && compound_eq(r->left, left) &&
+		    (left == NULL || r->s->op == s->op))
+			return;
+	}
+	if ((r = reallocarray(p->alts, p->nalts + 1, sizeof(*r))) == NULL)
+		err(1, "reallocarray");
+	alloc_bytes += sizeof(*r);
+	p->alts = r;
+	r = &p->alts[p->nalts++];
+	r->s = s;
+	r->left = left;
+	r->next = 0;
+}
+
+/*
+ * the alternatives of :is() or :not(), each the rightmost compound of one
+ * argument and the compound left of it.  A nested :is() is flattened into
+ * its parent and repeated alternatives are dropped.
+ */
+static void
+alt_compile(struct sel_pseudo *p)
+{
+	struct sel_pseudo *q;
+	struct sel *s, *left;
+	uint32_t i;
+
+	TAILQ_FOREACH(s, p->sub, next) {
+		switch (s->op) {
+		case EOP_NEVER:
+			continue;
+		case EOP_INSIDE:
+		case EOP_PARENT:
+		case EOP_NEXT:
+		case EOP_PRECED:
+			left = TAILQ_PREV(s, selhead, next);
+			break;
+		default:
+			left = NULL;
+			break;
+		}
+		if (left == NULL && (q = sel_bare_is(s)) != NULL) {
+			for (i = 0; i < q->nalts; i++)
+				alt_add(p, q->alts[i].s, q->alts[i].left);
+		} else
+			alt_add(p, s, left);
+	}
+}
+
+static void
+attr_copy(struct sel *s, struct sel_attr *a)
+{
+	struct sel_attr *c;
+
+	TAILQ_FOREACH(c, &s->attrs, next) {
+		if (attr_eq(c, a))
+			return;
+	}
+	if ((c = alloc_sel_attr()) == NULL)
+		err(1, "alloc_sel_attr");
+	if ((c->name = strdup(a->name)) == NULL ||
+	    (a->val != NULL && (c->val = strdup(a->val)) == NULL))
+		err(1, "strdup");
+	c->op = a->op;
+	c->flags = a->flags;
+	TAILQ_INSERT_TAIL(&s->attrs, c, next);
+}
+
+static int
+is_key(struct sel_attr *a)
+{
+	return((a->op == OP_EQ && strcasecmp(a->name, "id") == 0) ||
+	    (a->op == OP_CONTAINS && strcasecmp(a->name, "class") == 0));
+}
+
+/*
+ * move what every alternative of :is() asks of the node into s itself, so
+ * the cheap tests run first and a set can file s under the key.  With one
+ * alternative and nothing to its left the :is() is dropped altogether.
+ */
+static void
+is_hoist(struct sel *s, struct sel_pseudo *p)
+{
+	struct sel_attr *a, *b;
+	struct sel *t = p->alts[0].s;
+	uint32_t i;
+	int all;
+
+	for (i = 1; i < p->nalts; i++) {
+		if (strcasecmp(p->alts[i].s->elem, t->elem) != 0)
+			break;
+	}
+	if (i == p->nalts && strcmp(t->elem, "*") != 0 &&
+	    strcmp(s->elem, "*") == 0) {
+		free(s->elem);
+		if ((s->elem = strdup(t->elem)) == NULL)
+			err(1, "strdup");
+	}
+	TAILQ_FOREACH(a, &t->attrs, next) {
+		if (p->nalts > 1 && !is_key(a))
+			continue;
+		for (i = 1, all = 1; all && i < p->nalts; i++) {
+			all = 0;
+			TAILQ_FOREACH(b, &p->alts[i].s->attrs, next) {
+				if (attr_eq(a, b)) {
+					all = 1;
+					break;
+				}
+			}
+		}
+		if (all)
+			attr_copy(s, a);
+	}
+	if (p->nalts == 1 && p->alts[0].left == NULL &&
+	    TAILQ_EMPTY(&t->pseudos) &&
+	    (strcmp(t->elem, "*") == 0 || strcasecmp(t->elem, s->elem) == 0)) {
+		TAILQ_REMOVE(&s->pseudos, p, next);
+		free_sel_pseudo(p);
+	}
+}
+
+/* the argument of :contains() less the quotes */
+static char *
+text_arg(struct sel_pseudo *p, size_t *len)
+{
+	const char *a = p->arg;
+	char *s;
+	size_t n;
+
+	while (*a == ' ')
+		a++;
+	n = strlen(a);
+	while (n > 0 && a[n - 1] == ' ')
+		n--;
+	if (n >= 2 && (a[0] == '"' || a[0] == '\'') && a[n - 1] == a[0]) {
+		a++;
+		n -= 2;
+	}
+	if ((s = strndup(a, n)) == NULL)
+		err(1, "strndup");
+	alloc_bytes += n + 1;
+	*len = n;
+	return(s);
+}
+
+/*
+ * the text of :contains() is folded like the needles.  That of
+ * :contains-re() is compiled, its needle is the literal found in it so
+ * text_hits() can rule out the elements without it.
+ */
+static int
+text_compile(struct sel_pseudo *p)
+{
+	const char *lit;
+	char *s;
+	size_t i, n;
+
+	s = text_arg(p, &n);
+	if (p->type == PS_CONTAINS) {
+		for (i = 0; i < n; i++)
+			s[i] = FOLD((unsigned char)s[i]);
+		p->needle = s;
+		p->nlen = n;
+		return(0);
+	}
+	p->re = rx_compile(s, 0);
+	free(s);
+	if (p->re == NULL)
+		return(1);
+	lit = rx_lit(p->re, &n);
+	if ((p->needle = strndup(lit != NULL ? lit : "", n)) == NULL)
+		err(1, "strndup");
+	p->nlen = n;
+	return(0);
+}
+
+/*
+ * fold the attribute values of the selector once so the kernels below
+ * only fold the document side, compile the regular expressions and
+ * reduce :is() and :not() to their alternatives.  Called when the
+ * selector is parsed, for the arguments of those before the selector
+ * they are in.  Returns the number of errors.
+ */
 int
-match_sel(struct dom_elem *e, struct selhead *sh, int f)
+sel_compile(struct selhead *sh)
 {
-	struct dom_elem *c;
-	struct attr_elem *ea;
-	struct sel *s, *sp;
+	struct sel *s;
 	struct sel_attr *a;
-	char *p, *q;
-	ssize_t off;
+	struct sel_pseudo *p, *np;
+	size_t i;
 	int rc = 0;
+
+	TAILQ_FOREACH(s, sh, next) {
+		TAILQ_FOREACH_SAFE(p, &s->pseudos, next, np) {
+			if ((p->type != PS_IS && p->type != PS_NOT) ||
+			    p->sub == NULL || p->alts != NULL)
+				continue;
+			alt_compile(p);
+			if (p->type == PS_IS && p->nalts != 0)
+				is_hoist(s, p);
+		}
+		TAILQ_FOREACH(p, &s->pseudos, next) {
+			if ((p->type == PS_CONTAINS || p->type == PS_CONTAINS_RE) &&
+			    p->needle == NULL && p->re == NULL)
+				rc += text_compile(p);
+		}
+		TAILQ_FOREACH(a, &s->attrs, next) {
+			if (a->val == NULL || a->needle != NULL)
+				continue;
+			if (a->op == OP_REGEX &&
+			    (a->re = rx_compile(a->val, a->flags & SATTR_CASE)) == NULL)
+				rc++;
+			a->nlen = strlen(a->val);
+			if ((a->needle = strdup(a->val)) == NULL)
+				err(1, "strdup");
+			alloc_bytes += a->nlen + 1;
+			if (a->flags & SATTR_CASE)
+				continue;
+			for (i = 0; i < a->nlen; i++)
+				a->needle[i] = FOLD((unsigned char)a->needle[i]);
+		}
+	}
+	return(rc);
+}
+
+/* the first n bytes of v against the needle */
+static int
+needle_eq(const char *v, const char *needle, size_t n, int exact)
+{
+	const unsigned char *p = (const unsigned char *)v;
+	size_t i;
+
+	if (exact)
+		return(memcmp(v, needle, n) == 0);
+	for (i = 0; i < n; i++) {
+		if (FOLD(p[i]) != (unsigned char)needle[i])
+			return(0);
+	}
+	return(1);
+}
+
+/*
+ * first byte in p .. end that is c1 or c2.  Eight bytes are tested at a
+ * time with the usual has-zero-byte trick on the xor with each byte.
+ */
+static const char *
+find_byte2(const char *p, const char *end, unsigned char c1, unsigned char c2)
+{
+	uint64_t w, m1 = ONES * c1, m2 = ONES * c2;
+
+	for (; p + sizeof(w) <= end; p += sizeof(w)) {
+		memcpy(&w, p, sizeof(w));
+		if (HAS_ZERO(w ^ m1) | HAS_ZERO(w ^ m2))
+			break;
+	}
+	for (; p < end; p++) {
+		if ((unsigned char)*p == c1 || (unsigned char)*p == c2)
+			return(p);
+	}
+	return(NULL);
+}
+
+/* the first needle in v: scan for its first byte then compare the rest */
+const char *
+needle_find(const char *v, size_t vlen, const char *needle, size_t n,
+    int exact)
+{
+	const char *p, *last;
+	unsigned char c1, c2;
+
+	if (n == 0 || n > vlen)
+		return(NULL);
+	c1 = needle[0];
+	c2 = (!exact && c1 >= 'a' && c1 <= 'z') ? c1 - 0x20 : c1;
+	last = v + vlen - n;
+	for (p = v; p <= last; p++) {
+		if ((p = find_byte2(p, last + 1, c1, c2)) == NULL)
+			return(NULL);
+		if (needle_eq(p + 1, needle + 1, n - 1, exact))
+			return(p);
+	}
+	return(NULL);
+}
+
+/* *= */
+static int
+substr_match(const char *v, size_t vlen, struct sel_attr *a)
+{
+	return(needle_find(v, vlen, a->needle, a->nlen,
+	    a->flags & SATTR_CASE) != NULL);
+}
+
+/*
+ * compare one attribute of e against a selector attribute.  The lengths
+ * are checked first so most values are rejected without being read.
+ */
+static int
+attr_match(struct domhead *dh, struct dom_elem *e, struct attr_elem *ea,
+    struct sel_attr *a)
+{
+	const char *v;
+	size_t vlen, n = a->nlen;
+	int exact = a->flags & SATTR_CASE;
+
+	/* compare against the decoded value */
+	if ((v = attr_value(dh, ea, &vlen)) == NULL) {
+		v = "";
+		vlen = 0;
+	}
+	switch (a->op) {
+		case OP_EQ:
+			return(vlen == n && needle_eq(v, a->needle, n, exact));
+		case OP_EQ_START:	/* value or value- */
+			if (vlen == n)
+				return(needle_eq(v, a->needle, n, exact));
+			return(vlen > n && v[n] == '-' &&
+			    needle_eq(v, a->needle, n, exact));
+		case OP_START:
+			return(n != 0 && vlen >= n &&
+			    needle_eq(v, a->needle, n, exact));
+		case OP_END:
+			return(n != 0 && vlen >= n &&
+			    needle_eq(v + vlen - n, a->needle, n, exact));
+		case OP_SUBSTR:
+			return(substr_match(v, vlen, a));
+		case OP_REGEX:
+			return(a->re != NULL && rx_match(a->re, v, vlen));
+		case OP_CONTAINS:
+			/* class is already split into atoms */
+			if (DOM_INFO(dh, e)->ncls != 0 && !exact &&
+			    a->katom == dh->class_atom)
+				return(has_class(dh, e, a->atom));
+			return(word_match(v, vlen, a->val, exact));
+		case OP_MATCH:
+		default:
+			return(1);
+	}
+}
+
+static void
+sibs_grow(struct sel *s, uint32_t n)
+{
+	uint32_t *p;
+
+	if (s->nsibs >= n)
+		return;
+	if ((p = reallocarray(s->sibs, n, sizeof(uint32_t))) == NULL)
+		err(1, "reallocarray");
+	alloc_bytes += (n - s->nsibs) * sizeof(uint32_t);
+	memset(p + s->nsibs, 0, (n - s->nsibs) * sizeof(uint32_t));
+	s->sibs = p;
+	s->nsibs = n;
+}
+
+#define MATCH_NAME(_dh,_sn,_e) \
+		((strcmp("*",_sn) == 0) || ((_e)->type == DOMF_ELEM && \
+		 span_strcasecmp(_dh, (_e)->name, _sn) == 0))
+/*
+ * the nodes whose subtree, children or later siblings hold a match of the
+ * selector in :has().  The selector is matched once over the whole dom,
+ * then one pass from the last node back carries each match to its
+ * parent, or to its previous element sibling, so the cost is linear
+ * however deep the tree.
+ */
+static void
+has_memo(struct domhead *dh, struct sel_pseudo *p)
+{
+	struct dom_elem *e;
+	uint8_t *m, *sub;
+	uint32_t i, prev;
+
+	if (p->nmemo < dh->nelems) {
+		free(p->memo);
+		if ((p->memo = calloc(dh->nelems, 1)) == NULL)
+			err(1, "calloc");
+		alloc_bytes += dh->nelems;
+		p->nmemo = dh->nelems;
+	} else
+		memset(p->memo, 0, p->nmemo);
+	m = p->memo;
+
+	/* the matches of the argument, kept in bit 1 of the memo */
+	sel_prepare(dh, p->sub);
+	reset_sel(p->sub);
+	for (i = 1; i < dh->nelems; i++) {
+		e = DOM_NODE(dh, i);
+		if (e->type == DOMF_ELEM && match_sel(dh, e, p->sub, FLAG_NONE))
+			m[i] = 2;
+	}
+	/* bit 0 is the answer, the children come after their parent */
+	for (i = dh->nelems - 1; i > 0; i--) {
+		e = DOM_NODE(dh, i);
+		sub = &m[i];
+		prev = DOM_INFO(dh, e)->prev_el;
+		switch (p->rel) {
+			case EOP_PARENT:
+				if (*sub & 2)
+					m[e->parent] |= 1;
+				break;
+			case EOP_NEXT:
+				if ((*sub & 2) && prev != 0)
+					m[prev] |= 1;
+				break;
+			case EOP_PRECED:
+				/* bit 2 is a match here or in a later sibling */
+				if ((*sub & 6) && prev != 0)
+					m[prev] |= 5;
+				break;
+			case EOP_INSIDE:
+			default:
+				/* bit 2 is a match here or below */
+				if ((*sub & 6) && e->parent != DOM_ROOT)
+					m[e->parent] |= 5;
+				break;
+		}
+	}
+}
+
+/*
+ * every place the needle of :contains() is found in the text of the whole
+ * dom, see dom_text().  One scan answers for all the elements, an element
+ * holds the needle if a hit falls wholly inside its slice of the text.
+ */
+static void
+text_hits(struct domhead *dh, struct sel_pseudo *p)
+{
+	const char *t, *end;
+	uint32_t *h, n;
+
+	dom_text(dh);
+	p->nhits = 0;
+	if (p->nlen == 0 || dh->ntext < p->nlen)
+		return;
+	end = dh->text + dh->ntext;
+	for (t = dh->text;
+	    (t = needle_find(t, end - t, p->needle, p->nlen, 0)) != NULL; t++) {
+		if (p->nhits == p->hitsz) {
+			n = p->hitsz ? p->hitsz * 2 : 64;
+			if ((h = reallocarray(p->hits, n, sizeof(*h))) == NULL)
+				err(1, "reallocarray");
+			alloc_bytes += (n - p->hitsz) * sizeof(*h);
+			p->hits = h;
+			p->hitsz = n;
+		}
+		p->hits[p->nhits++] = t - dh->text;
+	}
+}
+
+static int
+text_match(struct domhead *dh, struct dom_elem *e, struct sel_pseudo *p)
+{
+	uint32_t lo, hi, l, r, m;
+
+	if (p->nlen == 0)
+		return(1);
+	lo = dh->toff[DOM_IDX(dh, e)];
+	hi = dh->toff[e->end + 1];
+	if (hi - lo < p->nlen)
+		return(0);
+	/* the first hit at or after lo */
+	for (l = 0, r = p->nhits; l < r; ) {
+		m = l + (r - l) / 2;
+		if (p->hits[m] < lo)
+			l = m + 1;
+		else
+			r = m;
+	}
+	return(l < p->nhits && p->hits[l] + p->nlen <= hi);
+}
+
+/*
+ * bind a parsed selector to the dom before matching: find its atoms and
+ * work out its :has() arguments, innermost first.  The arguments of :is()
+ * and :not() are only bound.
+ */
+void
+sel_prepare(struct domhead *dh, struct selhead *sh)
+{
+	struct sel *s;
+	struct sel_pseudo *p;
+
+	sel_atoms(dh, sh);
+	TAILQ_FOREACH(s, sh, next) {
+		TAILQ_FOREACH(p, &s->pseudos, next) {
+			if (p->type == PS_CONTAINS || p->type == PS_CONTAINS_RE)
+				text_hits(dh, p);
+			if (p->sub == NULL)
+				continue;
+			if (p->type == PS_HAS)
+				has_memo(dh, p);
+			else
+				sel_prepare(dh, p->sub);
+		}
+	}
+}
+
+/* i, from 1, is a*n+b for some n >= 0 */
+static int
+nth_match(int a, int b, uint32_t i)
+{
+	int d = (int)i - b;
+
+	if (a == 0)
+		return(d == 0);
+	return(d / a >= 0 && d % a == 0);
+}
+
+/* the ordinals are counted once after parsing, see type_ordinals() */
+static int
+pseudo_match(struct domhead *dh, struct dom_elem *e, struct sel_pseudo *p)
+{
+	struct dom_elem *pe = DOM_NODE(dh, e->parent), *c;
+	struct elem_info *x = DOM_INFO(dh, e), *px = DOM_INFO(dh, pe);
+	uint32_t i;
+
+	switch (p->type) {
+		case PS_NTH_CHILD:
+			return(nth_match(p->a, p->b, x->pos));
+		case PS_NTH_LAST_CHILD:
+			return(nth_match(p->a, p->b, px->nel - x->pos + 1));
+		case PS_NTH_OF_TYPE:
+			return(nth_match(p->a, p->b, x->tpos));
+		case PS_NTH_LAST_OF_TYPE:
+			return(nth_match(p->a, p->b, x->ntype - x->tpos + 1));
+		case PS_ONLY_CHILD:
+			return(px->nel == 1);
+		case PS_ONLY_OF_TYPE:
+			return(x->ntype == 1);
+		case PS_ROOT:
+			return(is_top(e));
+		case PS_HAS:
+			return(p->memo != NULL && DOM_IDX(dh, e) < p->nmemo &&
+			    (p->memo[DOM_IDX(dh, e)] & 1));
+		case PS_CONTAINS:
+			return(text_match(dh, e, p));
+		case PS_CONTAINS_RE:
+			i = DOM_IDX(dh, e);
+			return(p->re != NULL && text_match(dh, e, p) &&
+			    rx_exec(p->re, dh->text + dh->toff[i],
+			    dh->toff[e->end + 1] - dh->toff[i]));
+		case PS_IS:
+		case PS_NOT:
+			for (i = 0; i < p->nalts; i++) {
+				if (match_rel(dh, e, p->alts[i].s, p->alts[i].left))
+					return(p->type == PS_IS);
+			}
+			return(p->type == PS_NOT);
+		case PS_EMPTY:
+			DOM_FOREACH_CHILD(c, dh, e) {
+				if (c->type == DOMF_ELEM ||
+				    (c->type == DOMF_TEXT && c->value.len != 0))
+					return(0);
+			}
+			return(1);
+		default:
+			return(0);
+	}
+}
+
+/*
+ * e has the name and all the attributes of s.  class and id are
+ * attributes too so there can be several, each is found by its name atom,
+ * see elem_attr().
+ */
+int
+match_compound(struct domhead *dh, struct dom_elem *e, struct sel *s)
+{
+	struct attr_elem *ea;
+	struct sel_attr *a;
+	struct sel_pseudo *p;
+
+	if (!MATCH_NAME(dh, s->elem, e))
+		return(0);
+	TAILQ_FOREACH(a, &s->attrs, next) {
+		if (a->katom == ATOM_NONE ||
+		    (ea = elem_attr(dh, e, a->katom)) == NULL)
+			return(0);
+		if (a->op != OP_MATCH && !attr_match(dh, e, ea, a))
+			return(0);
+	}
+	TAILQ_FOREACH(p, &s->pseudos, next) {
+		if (e->type != DOMF_ELEM || !pseudo_match(dh, e, p))
+			return(0);
+	}
+	return(1);
+}
+
+/*
+ * e matches the compound s and, when there is one, the compound left of
+ * s through the combinator of s.  The left side is found by walking from
+ * e, see selset.c.
+ */
+int
+match_rel(struct domhead *dh, struct dom_elem *e, struct sel *s,
+    struct sel *left)
+{
+	struct dom_elem *pv;
+	uint32_t i;
+
+	if (!match_compound(dh, e, s))
+		return(0);
+	if (left == NULL)
+		return(1);
+	switch (s->op) {
+		case EOP_INSIDE:
+			for (i = e->parent; i != DOM_ROOT;
+			    i = DOM_NODE(dh, i)->parent) {
+				if (match_compound(dh, DOM_NODE(dh, i), left))
+					return(1);
+			}
+			return(0);
+		case EOP_PARENT:
+			return(!is_top(e) &&
+			    match_compound(dh, DOM_NODE(dh, e->parent), left));
+		case EOP_NEXT:
+			return((pv = prev_elem(dh, e)) != NULL &&
+			    match_compound(dh, pv, left));
+		case EOP_PRECED:
+			for (pv = prev_elem(dh, e); pv != NULL;
+			    pv = prev_elem(dh, pv)) {
+				if (match_compound(dh, pv, left))
+					return(1);
+			}
+			return(0);
+		default:
+			return(1);
+	}
+}
+
+/* sh is a lone * or empty compound, with no attributes or pseudo-classes */
+int
+sel_bare(struct selhead *sh)
+{
+	struct sel *s = TAILQ_FIRST(sh);
+
+	return(s != NULL && TAILQ_NEXT(s, next) == NULL &&
+	    (strcmp("*", s->elem) == 0 || s->elem[0] == '\0') &&
+	    TAILQ_EMPTY(&s->attrs) && TAILQ_EMPTY(&s->pseudos));
+}
+
+int
+match_sel(struct domhead *dh, struct dom_elem *e, struct selhead *sh, int f)
+{
+	return(match_query(dh, e, sh, f, QUERY_BIT(0)));
+}
+
+/* bit is the query of sh in match, text follows its parent's match */
+static int
+match_query(struct domhead *dh, struct dom_elem *e, struct selhead *sh, int f,
+    uint16_t bit)
+{
+	struct dom_elem *pe;
+	struct sel *s, *sp, *sn, *rs = NULL;
+	uint32_t pos;
 	int match = 0;
-	int cnt = 0;
-	int cmp = 0;
 
+	pe = DOM_NODE(dh, e->parent);
 	if (e->type == DOMF_COMM) {
 		/* mark if flagged or if parent matches */
-		if (f & FLAG_COMMENT || e->parent->match == 1) {
-			s = TAILQ_FIRST(sh);
-	   		if (strcmp("*", s->elem) == 0 ||
-				s->elem[0] == '\0' ||
-				e->parent->match == 1) {
+		if (f & FLAG_COMMENT || (pe->match & bit)) {
+			/* a bare * or empty selector takes all of them */
+	   		if (sel_bare(sh) || (pe->match & bit)) {
 //				strcasecmp(s->elem, e->parent->name) == 0) {
 					return(1);
 			}
@@ -107,11 +889,9 @@ match_sel(struct dom_elem *e, struct selhead *sh, int f)
 
 	if (e->type == DOMF_TEXT) {
 		/* mark if flagged or if parent matches */
-		if (f & FLAG_TEXT || e->parent->match == 1) {
-			s = TAILQ_FIRST(sh);
-	   		if (strcmp("*", s->elem) == 0 ||
-				s->elem[0] == '\0' ||
-				e->parent->match == 1) {
+		if (f & FLAG_TEXT || (pe->match & bit)) {
+			/* a bare * or empty selector takes all of them */
+	   		if (sel_bare(sh) || (pe->match & bit)) {
 //				strcasecmp(s->elem, e->parent->name) == 0) {
 					return(1);
 			}
@@ -119,83 +899,25 @@ match_sel(struct dom_elem *e, struct selhead *sh, int f)
 		return(0);
 	}
 
+	pos = DOM_INFO(dh, e)->pos;
 	// check for name match
 	TAILQ_FOREACH(s, sh, next) {
-//		if (strcmp("*",s->elem) == 0 ||
-//			strcasecmp(s->elem, e->name) == 0) {
-		if (MATCH_NAME(s->elem, e->name)) {
-			// no selector attributes.  just match on names. simple match.
-			if (TAILQ_EMPTY(&s->attrs)) {
-				match = 1;
-				goto found;
-			}
-			// no element attributes, but we have selection attributes. we can never match
-			if (TAILQ_EMPTY(&e->attrs)) {
-				match = 0;
-				goto found;
-			}
-			// NOTE: class and id are also attributes. Because of this there can be more than
-			// one attribute.  All selector attributes must match in order for the element to
-			// be considred matching.
-			//
-			// loop through all attributes for match
-			TAILQ_FOREACH(ea, &e->attrs, next) { // check all attribures on e
-				TAILQ_FOREACH(a, &s->attrs, next) { // this will typically loop only once unless class/id is specified
-					if (strcasecmp(ea->key,a->name) != 0) { // key doesn match, skip to next
-						cnt++;
-						continue;
-					}
-					switch(a->op) {
-						case OP_EQ:
-							cmp = strcasecmp(ea->value,a->val);
-							if (cmp == 0)
-								rc++;
-							break;
-						case OP_EQ_START:
-							cmp = strcasecmp(ea->value,a->val);
-							if (cmp != 0 ) {
-								if (asprintf(&q,"%s-",a->val) == -1)
-									err(1,"asprintf");
-								p = strcasestr(ea->value,q);
-								if (p != NULL && p == ea->value)
-									rc++;
-								free(q);
-							} else
-								rc++;
-							break;
-						case OP_START:
-							cmp = strcasecmp(ea->value,a->val);
-							p = strcasestr(ea->value, a->val);
-							if (cmp == 0 && p != NULL && p == ea->value)
-								rc++;
-							break;
-						case OP_END:
-							cmp = strcasecmp(ea->value,a->val);
-							p = strcasestr(ea->value, a->val);
-							off = strlen(ea->value) - strlen(a->val);
-							if (cmp == 0 && p != NULL && p == (ea->value + off))
-								rc++;
-							break;
-						case OP_CONTAINS: // not exactly correct
-						case OP_SUBSTR:
-							cmp = strcasecmp(ea->value,a->val);
-							if (cmp == 0 && (strcasestr(ea->value, a->val) != NULL))
-								rc++;
-							break;
-						case OP_MATCH:
-						default:	// include MATCH
-							rc++;
-							break;
-					} // switch op
-					cnt++;
-				} // foreach ea attr
-				// check to make the RC value and the count value match.
-				if (cnt == rc) {	// all selectors matched
-					match=1;
-				}
-			} // foreach sel attr
-		}	// check elem name
-found:
+		/* a miss leaves match alone so "a, b" is the union of both */
+		if (match_compound(dh, e, s))
+			match = 1;
+
+		/*
+		 * remember the subtree of the last node that matched as the left
+		 * side of a descendant selector, see EOP_INSIDE.
+		 */
+		if (match && s->op == EOP_NEVER && (s->scope == 0 ||
+		    e->end > DOM_NODE(dh, s->scope)->end))
+			s->scope = DOM_IDX(dh, e);
+		/* for sibling selectors, recorded once e itself is done */
+		if (match && s->op == EOP_NEVER && pos != 0 &&
+		    (sn = TAILQ_NEXT(s, next)) != NULL &&
+		    (sn->op == EOP_NEXT || sn->op == EOP_PRECED))
+			rs = s;
 		/* if we have a pleminary match, check to see if the element op will unmatch the element */
 		if (match) {
 //printf("looking at op %s\n",elem_op_str[s->op]);
@@ -206,16 +928,15 @@ found:
 				case EOP_INSIDE:	/*  div p   Selects all <p> elements inside <div> elements */
 					sp = TAILQ_FIRST(sh);
 					if (s != sp) {
+						/*
+						 * nodes are seen in preorder so e is inside one of
+						 * the matches of sp iff it is inside the one whose
+						 * subtree reaches furthest.
+						 */
 						sp = TAILQ_PREV(s, selhead, next);
-						if (is_top(e)) {
+						if (sp->scope == 0 ||
+						    !DOM_INSIDE(dh, DOM_IDX(dh, e), sp->scope))
 							match = 0;
-						} else {
-							c = e->parent;
-//							if (strcasecmp(c->name, sp->elem) != 0) {
-							if (!MATCH_NAME(sp->elem, c->name)) {
-								match = 0;
-							}
-						}
 					} else {
 						match = 0;
 					}
@@ -224,9 +945,8 @@ found:
 					sp = TAILQ_FIRST(sh);
 					if (s != sp) {// not first node
 						sp = TAILQ_PREV(s, selhead, next);
-						if (strcasecmp(e->parent->name, sp->elem) != 0) {
+						if (is_top(e) || !match_compound(dh, pe, sp))
 							match = 0;
-						}
 					} else {
 						match = 0;
 					}
@@ -234,30 +954,20 @@ found:
 				case EOP_NEXT:	/* div + p     Selects the first <p> element that is placed immediately after <div> elements */
 					sp = TAILQ_FIRST(sh);
 					if (s != sp) {
-						// find the previous non-TEXT element
-						c = prev_elem(e);
-						if (c == NULL) {
+						/* the previous element sibling matched sp */
+						sp = TAILQ_PREV(s, selhead, next);
+						if (sp->sibs == NULL || pos < 2 ||
+						    sp->sibs[e->parent] != pos - 1)
 							match = 0;
-						} else {
-//							if (strcasecmp(c->name, sp->elem) != 0) {
-							if (!MATCH_NAME(sp->elem, c->name)) {
-								match = 0;
-							}
-						}
 					}
 					break;
 				case EOP_PRECED: /* p ~ ul  Selects every <ul> element that is preceded by a <p> element */
 					sp = TAILQ_PREV(s,selhead,next);
 					if (s != sp) {
-						c = prev_elem(e);
-						if (c == NULL) {
+						/* some earlier element sibling matched sp */
+						if (sp->sibs == NULL || sp->sibs[e->parent] == 0 ||
+						    sp->sibs[e->parent] >= pos)
 							match = 0;
-						} else {
-//							if (strcasecmp(c->name, sp->elem) != 0) {
-							if (!MATCH_NAME(sp->elem, c->name)) {
-								match = 0;
-							}
-						}
 					}
 					break;
 				case EOP_MATCH:		/* fallthrough */
@@ -268,6 +978,16 @@ found:
 		} // if match
 	} // foreach sel
 
+	/*
+	 * keep the position of the last (+) or first (~) match of the left
+	 * side among the children of each parent.
+	 */
+	if (rs != NULL) {
+		sibs_grow(rs, dh->nelems);
+		sn = TAILQ_NEXT(rs, next);
+		if (sn->op == EOP_NEXT || rs->sibs[e->parent] == 0)
+			rs->sibs[e->parent] = pos;
+	}
   return(match);
 }
 
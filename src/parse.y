@@ -45,23 +45,31 @@ int                     yylex(void);
 typedef struct {
         union {
                 int64_t         number;
-                char            *string;
-				struct attr_elem	*attr;
+                struct span     span;
         } v;
         int lineno;
 		int st_lineno;
 } YYSTYPE;
 
 struct domhead *head;
-struct dom_elem *top, *cur;
+uint32_t top, cur;
+struct lastnode {
+	uint32_t child;
+	uint32_t elem;
+} *last;					/* last children of each node while parsing */
+uint32_t lastsz;
 int inelem;
 
+static uint32_t add_node(int, struct span, int);
+static void pop_elem(void);
+static void set_span(char *, char *);
+static void subtree_ends(struct domhead *);
+
 %}
 %token DOCTYPE
-%token 	<v.string>      STRING
-%token	<v.string>      TEXT
-%token	<v.string>      COMMENT
-%type	<v.attr>		attr
+%token 	<v.span>        STRING
+%token	<v.span>        TEXT
+%token	<v.span>        COMMENT
 
 
 %%
@@ -76,127 +84,190 @@ html		: /* empty */
 
 doctype		: DOCTYPE STRING {
 		 		struct dom_elem *e;
-				e = alloc_elem();
-				e->head = head;
-				e->name = strdup("doctype");
+				uint32_t i;
+				i = add_node(DOMF_DOCT, $2, yylval.lineno);
+				e = DOM_NODE(head, i);
 				e->value = $2;
-				e->type = DOMF_DOCT;
-				e->line = yylval.lineno;
-				e->parent = e;				// top points to itself
-				TAILQ_INSERT_HEAD(head, e, next);	// doctype will always be part of the head
+				e->name.len = 0;
 		 	}
 		 	;
 
 comment		: COMMENT {
 		 		struct dom_elem *e;
-				e = alloc_elem();
-				e->head = head;
-				e->name = strdup("COMMENT");
+				uint32_t i;
+				i = add_node(DOMF_COMM, $1, yylval.lineno);
+				e = DOM_NODE(head, i);
 				e->value = $1;
-				e->type = DOMF_COMM;
-				e->line = yylval.lineno;
-				if (cur == NULL) {
-					e->parent = e;				// top points to itself
-					TAILQ_INSERT_TAIL(head, e, next);
-				} else {
-					TAILQ_INSERT_TAIL(&cur->children, e, next);
-					e->parent = cur;
-				}
+				e->name.len = 0;
 			}
 		 	;
 
 text		: TEXT {
 		 		struct dom_elem *e;
-				e = alloc_elem();
-				e->head = head;
-				e->name = strdup("TEXT");
+				uint32_t i;
+				i = add_node(DOMF_TEXT, $1, yylval.st_lineno);
+				e = DOM_NODE(head, i);
 				e->value = $1;
-				e->type = DOMF_TEXT;
-				e->line = yylval.st_lineno;
-				if (cur == NULL) {
-					e->parent = e;				// top points to itself
-					TAILQ_INSERT_TAIL(head, e, next);
-				} else {
-					TAILQ_INSERT_TAIL(&cur->children, e, next);
-					e->parent = cur;
-				}
+				e->name.len = 0;
 	  		}
 
 fullelem	: elem {
-				/* some elements to not have closing tags so we just end*/
-				if (unterminated_element(cur->name) == 1) {
-					cur->flags |= ELEM_NOEND;
-					cur = cur->parent;
-				}
+				/* void elements do not have closing tags so we just end */
+				if (DOM_NODE(head, cur)->flags & ELEM_NOEND)
+					pop_elem();
 		 	}
 			| elem '/' {
-				cur->flags |= ELEM_INLINE;
-				cur = cur->parent;
+				DOM_NODE(head, cur)->flags |= ELEM_INLINE;
+				pop_elem();
 			}
 		 	;
 
 elem		: STRING {
 	  			struct dom_elem *e;
-				e = alloc_elem();
-				e->head = head;
-				e->name = $1;
-				e->type = DOMF_ELEM;
-				e->line = yylval.lineno;
-				if (cur == NULL) {
-					top = e;
-					cur = e;
-					e->parent = e;				// top points to itself
-					TAILQ_INSERT_TAIL(head, e, next);
-				} else {
-					TAILQ_INSERT_TAIL(&cur->children, e, next);
-					e->parent = cur;
-					cur = e;
-				}
+				uint32_t i;
+				i = add_node(DOMF_ELEM, $1, yylval.lineno);
+				e = DOM_NODE(head, i);
+				if (void_element(DOM_STR(head, $1), $1.len))
+					e->flags |= ELEM_NOEND;
+				e->attr = head->nattrs;
+				if (top == DOM_ROOT)
+					top = i;
+				cur = i;
 	  		} elem_attrs
 			;
 
 endelem		: STRING {
 		 		struct dom_elem *e;
-		 		if (strcasecmp(cur->name, $1) != 0) {
-					warnx("found end %s expecting %s line %d",$1,cur->name,yylval.lineno);
-					e = cur;
-					while (!is_top(e) && strcasecmp($1,e->name) != 0) {
-							e = e->parent;
+				if (cur == DOM_ROOT) {
+					warnx("found end %.*s without start line %d",
+					    (int)$1.len, DOM_STR(head, $1), yylval.lineno);
+				} else if (span_casecmp(head, DOM_NODE(head, cur)->name, $1) != 0) {
+					e = DOM_NODE(head, cur);
+					warnx("found end %.*s expecting %.*s line %d",
+					    (int)$1.len, DOM_STR(head, $1), (int)e->name.len,
+					    DOM_STR(head, e->name), yylval.lineno);
+					while (!is_top(e) && span_casecmp(head, $1, e->name) != 0) {
+							e = DOM_NODE(head, e->parent);
 						}
-					if (!is_top(e)) {
-						e = e->parent;
-					}
-					cur = e;
+					if (span_casecmp(head, $1, e->name) == 0)
+						DOM_INFO(head, e)->etag = $1.off;
+					cur = DOM_IDX(head, e);
+					if (!is_top(e))
+						pop_elem();
 				} else {
-			 		cur = cur->parent;
+					e = DOM_NODE(head, cur);
+					DOM_INFO(head, e)->etag = $1.off;
+					pop_elem();
 				}
-				free($1);
 		 	}
 
 elem_attrs	: /* empty */
 		   	| elem_attrs STRING {
-				struct attr_elem *a;			
-				a = alloc_attr();
+				struct attr_elem *a;
+				uint32_t i;
+				i = alloc_attr(head);
+				a = &head->attrs[i];
 				a->key = $2;
-				TAILQ_INSERT_TAIL(&cur->attrs, a, next);
+				DOM_NODE(head, cur)->nattr++;
 			}
-			| elem_attrs attr {
-				TAILQ_INSERT_TAIL(&cur->attrs, $2, next);
-			}
-			;
-
-attr		: STRING '=' STRING {
-	  			struct attr_elem *a;
-				a = alloc_attr();
-				a->key = $1;
-				a->value = $3;
-				$$ = a;
+			| elem_attrs STRING '=' STRING {
+				struct attr_elem *a;
+				uint32_t i;
+				i = alloc_attr(head);
+				a = &head->attrs[i];
+				a->key = $2;
+				a->value = $4;
+				DOM_NODE(head, cur)->nattr++;
 	  		}
-	  		;
+			;
 
 
 %%
 
+/*
+ * append a node to the children of cur.  Nodes are only ever added in
+ * document order so the array stays in preorder.
+ */
+static uint32_t
+add_node(int type, struct span name, int line)
+{
+	struct dom_elem *e, *p;
+	struct elem_info *x, *px;
+	uint32_t i;
+
+	i = alloc_elem(head);
+	if (i >= lastsz) {
+		if ((last = reallocarray(last, head->elemsz,
+		    sizeof(struct lastnode))) == NULL)
+			err(1, "reallocarray");
+		lastsz = head->elemsz;
+	}
+	last[i].child = last[i].elem = 0;
+	e = DOM_NODE(head, i);
+	e->type = type;
+	e->name = name;
+	e->line = line;
+	e->parent = cur;
+	e->end = i;
+	if (type == DOMF_ELEM || type == DOMF_ROOT)
+		e->info = alloc_info(head);
+	p = DOM_NODE(head, cur);
+	if (last[cur].child == 0)
+		p->child = i;
+	else
+		DOM_NODE(head, last[cur].child)->next = i;
+	last[cur].child = i;
+	/* elements are also linked among themselves, skipping text */
+	if (type == DOMF_ELEM) {
+		x = DOM_INFO(head, e);
+		if (last[cur].elem == 0)
+			x->pos = 1;
+		else {
+			px = DOM_INFO(head, DOM_NODE(head, last[cur].elem));
+			px->next_el = i;
+			x->prev_el = last[cur].elem;
+			x->pos = px->pos + 1;
+		}
+		last[cur].elem = i;
+	}
+	return(i);
+}
+
+/* the top element is never closed, everything after it is its child */
+static void
+pop_elem(void)
+{
+	if (!is_top(DOM_NODE(head, cur)))
+		cur = DOM_NODE(head, cur)->parent;
+}
+
+/*
+ * the nodes are in preorder so the subtree of n is n + 1 .. end.  Going
+ * backwards every subtree is complete before it is passed to the parent.
+ */
+static void
+subtree_ends(struct domhead *dh)
+{
+	struct dom_elem *e, *p;
+	uint32_t i;
+
+	for (i = dh->nelems - 1; i > 0; i--) {
+		e = DOM_NODE(dh, i);
+		p = DOM_NODE(dh, e->parent);
+		if (e->end > p->end)
+			p->end = e->end;
+	}
+}
+
+static void
+set_span(char *st, char *p)
+{
+	if (st > p)
+		fatal("%slex: bad token", YYPREFIX);
+	yylval.v.span.off = st - raw_data;
+	yylval.v.span.len = p - st;
+}
+
 int
 yylex(void)
 {
@@ -241,8 +312,9 @@ yylex(void)
 					}
 					p++;
 				}
-				if ((yylval.v.string = extract_str(st,p)) == NULL)
-					fatal("%slex: extract_str",YYPREFIX);
+				/* the string ends at the closing quote */
+				p = raw_data + raw_off - 1;
+				set_span(st, p);
 				return(STRING);
 				break;
 			case '/':
@@ -261,8 +333,9 @@ yylex(void)
 						st = p = raw_data + raw_off;
 						while(c != EOF) {
 							if (c == '-' && (c = lgetc(0)) == '-' && (c = lgetc(0)) == '>') {
-								if ((yylval.v.string = extract_str(st,p)) == NULL)
-									fatal("%slex: extract_str",YYPREFIX);
+								/* the comment ends at the "-->" */
+								p = raw_data + raw_off - 3;
+								set_span(st, p < st ? st : p);
 								lungetc(c);
 								return(COMMENT);
 							}
@@ -275,13 +348,9 @@ yylex(void)
 							c = lgetc(0);
 							p++;
 						}
-						if ((yylval.v.string = extract_str(st,p)) == NULL)
-									fatal("%slex: extract_str",YYPREFIX);
-						if (strcasecmp(yylval.v.string,"DOCTYPE") == 0) {
-							free(yylval.v.string);
-							yylval.v.string = NULL;
+						if (p - st == 7 && strncasecmp(st, "DOCTYPE", 7) == 0)
 							return(DOCTYPE);
-						}
+						set_span(st, p);
 						// not doctype... just return string
 						return(STRING);
 					}
@@ -296,9 +365,9 @@ yylex(void)
 					c = lgetc(0);
 					p++;
 				}
-				if ((yylval.v.string = extract_str(st,p)) == NULL)
-							fatal("%slex: extract_str",YYPREFIX);
-				lungetc(c);
+				set_span(st, p);
+				if (c != EOF)
+					lungetc(c);
 				return(STRING);
 				break;
 		}	// switch(c)
@@ -312,12 +381,35 @@ yylex(void)
 		p++;
 		c = lgetc(0);
 	}
-	lungetc(c);
-	if ((yylval.v.string = extract_str(st,p)) == NULL)
-		fatal("%slex: extract_str",YYPREFIX);
+	/* EOF was not read, giving it back would read the text again */
+	if (c != EOF)
+		lungetc(c);
+	set_span(st, p);
 	return(TEXT);
 }
 
+/*
+ * run only the lexer over raw and return the number of tokens.  Used by
+ * the micro benchmarks to time yylex() on its own.
+ */
+size_t
+lex_dom(char *raw, size_t sz)
+{
+	size_t n = 0;
+	int tok;
+
+	init_buf(raw, sz);
+	inelem = 0;
+	yylval.lineno = 1;
+	while ((tok = yylex()) != 0)
+		n++;
+	return(n);
+}
+
+/*
+ * build the dom for raw.  Names and values point into raw so it has to
+ * outlive the dom.
+ */
 int
 parse_dom(struct domhead *dh, char *raw, size_t sz)
 {
@@ -325,15 +417,26 @@ parse_dom(struct domhead *dh, char *raw, size_t sz)
 		return(-1);
 	if (sz <= 0)
 		return(-1);
-	
+	if (sz > UINT32_MAX)
+		errx(1, "input too large");
+
+	memset(dh, 0, sizeof(*dh));
+	dh->raw = raw;
+	dh->rawlen = sz;
 	head = dh;
-	top = NULL;
-	cur = top;
+	last = NULL;
+	lastsz = 0;
+	top = cur = DOM_ROOT;
+	add_node(DOMF_ROOT, (struct span){ 0, 0 }, 0);
 	init_buf(raw, sz);
 	inelem = 0;
 	errors = 0;
 	yylval.lineno = 1;
 
 	yyparse();
+	free(last);
+	last = NULL;
+	subtree_ends(dh);
+	dom_atoms(dh);
 	return(errors);
 }
@@ -0,0 +1,226 @@
+/* $Id$ */
+/*
+ * Copyright (c) 2024 Michael Graves
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * hardware counters around the phases timed in stats.c.  Only Linux
+ * perf_event_open(2) is supported, everywhere else (or when the kernel
+ * refuses, e.g. perf_event_paranoid or no PMU in a VM) the counters are
+ * reported as unavailable and hq carries on.
+ */
+
+#include "config.h"
+
+#if HAVE_SYS_QUEUE
+#include <sys/queue.h>
+#endif
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+#if HAVE_ERR
+#include <err.h>
+#endif
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "hq.h"
+
+enum {
+	CNT_CYCLES,
+	CNT_INSTR,
+	CNT_BRMISS,
+	CNT_CACHEMISS,
+	CNT_MAX
+};
+
+static const char *cnt_str[] = {
+	"cycles",
+	"instructions",
+	"branch_misses",
+	"cache_misses"
+};
+
+struct sample {
+	uint64_t	value;
+	uint64_t	enabled;
+	uint64_t	running;
+};
+
+int perf_enabled;
+static int fds[CNT_MAX] = { -1, -1, -1, -1 };
+static struct sample start[PHASE_MAX][CNT_MAX];
+static double total[PHASE_MAX][CNT_MAX];
+
+static int read_sample(int, struct sample *);
+
+#if defined(__linux__)
+static const uint64_t cnt_config[CNT_MAX] = {
+	PERF_COUNT_HW_CPU_CYCLES,
+	PERF_COUNT_HW_INSTRUCTIONS,
+	PERF_COUNT_HW_BRANCH_MISSES,
+	PERF_COUNT_HW_CACHE_MISSES
+};
+
+/*
+ * open one counting event per counter for this process, user space only
+ * so it works with the default perf_event_paranoid.  Returns the number
+ * of counters opened.
+ */
+int
+perf_open(void)
+{
+	struct perf_event_attr pa;
+	int i, n = 0, saved = 0;
+
+	for (i = 0; i < CNT_MAX; i++) {
+		memset(&pa, 0, sizeof(pa));
+		pa.type = PERF_TYPE_HARDWARE;
+		pa.size = sizeof(pa);
+		pa.config = cnt_config[i];
+		pa.exclude_kernel = 1;
+		pa.exclude_hv = 1;
+		pa.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED |
+		    PERF_FORMAT_TOTAL_TIME_RUNNING;
+		fds[i] = syscall(SYS_perf_event_open, &pa, 0, -1, -1, 0);
+		if (fds[i] == -1)
+			saved = errno;
+		else
+			n++;
+	}
+	if (n == 0)
+		warnx("hardware counters unavailable: %s", strerror(saved));
+	perf_enabled = (n > 0);
+	return(n);
+}
+#else
+int
+perf_open(void)
+{
+	warnx("hardware counters are only supported on Linux");
+	return(0);
+}
+#endif
+
+static int
+read_sample(int fd, struct sample *s)
+{
+	if (fd == -1)
+		return(-1);
+	if (read(fd, s, sizeof(*s)) != sizeof(*s))
+		return(-1);
+	return(0);
+}
+
+void
+perf_start(int p)
+{
+	int i;
+
+	for (i = 0; i < CNT_MAX; i++)
+		read_sample(fds[i], &start[p][i]);
+}
+
+/* scale for the time the counter was multiplexed out */
+void
+perf_stop(int p)
+{
+	struct sample s;
+	double v;
+	int i;
+
+	for (i = 0; i < CNT_MAX; i++) {
+		if (read_sample(fds[i], &s) == -1)
+			continue;
+		v = s.value - start[p][i].value;
+		if (s.running > start[p][i].running)
+			v *= (double)(s.enabled - start[p][i].enabled) /
+			    (s.running - start[p][i].running);
+		total[p][i] += v;
+	}
+}
+
+/* misses are reported per KB of input */
+void
+perf_print(FILE *f, size_t input, int json)
+{
+	double kb = input / 1024.0, ipc;
+	int p, i;
+
+	if (kb == 0)
+		kb = 1;
+	if (json) {
+		fprintf(f, "{\"input_bytes\":%zu,\"phases\":{", input);
+		for (p = 0; p < PHASE_MAX; p++) {
+			fprintf(f, "%s\"%s\":{", p ? "," : "", phase_str[p]);
+			for (i = 0; i < CNT_MAX; i++) {
+				if (fds[i] == -1)
+					fprintf(f, "\"%s\":null,", cnt_str[i]);
+				else
+					fprintf(f, "\"%s\":%.0f,", cnt_str[i], total[p][i]);
+			}
+			if (fds[CNT_CYCLES] != -1 && fds[CNT_INSTR] != -1 &&
+			    total[p][CNT_CYCLES] > 0)
+				fprintf(f, "\"ipc\":%.3f,", total[p][CNT_INSTR] /
+				    total[p][CNT_CYCLES]);
+			else
+				fprintf(f, "\"ipc\":null,");
+			fprintf(f, "\"branch_misses_per_kb\":");
+			if (fds[CNT_BRMISS] != -1)
+				fprintf(f, "%.3f,", total[p][CNT_BRMISS] / kb);
+			else
+				fprintf(f, "null,");
+			fprintf(f, "\"cache_misses_per_kb\":");
+			if (fds[CNT_CACHEMISS] != -1)
+				fprintf(f, "%.3f}", total[p][CNT_CACHEMISS] / kb);
+			else
+				fprintf(f, "null}");
+		}
+		fprintf(f, "}}\n");
+		return;
+	}
+	fprintf(f, "%-12s %14s %14s %6s %12s %13s\n", "phase", "cycles",
+	    "instructions", "IPC", "br-miss/KB", "cache-miss/KB");
+	for (p = 0; p < PHASE_MAX; p++) {
+		fprintf(f, "%-12s", phase_str[p]);
+		for (i = CNT_CYCLES; i <= CNT_INSTR; i++) {
+			if (fds[i] == -1)
+				fprintf(f, " %14s", "n/a");
+			else
+				fprintf(f, " %14.0f", total[p][i]);
+		}
+		ipc = total[p][CNT_CYCLES] > 0 ?
+		    total[p][CNT_INSTR] / total[p][CNT_CYCLES] : 0;
+		if (fds[CNT_CYCLES] == -1 || fds[CNT_INSTR] == -1)
+			fprintf(f, " %6s", "n/a");
+		else
+			fprintf(f, " %6.2f", ipc);
+		if (fds[CNT_BRMISS] == -1)
+			fprintf(f, " %12s", "n/a");
+		else
+			fprintf(f, " %12.2f", total[p][CNT_BRMISS] / kb);
+		if (fds[CNT_CACHEMISS] == -1)
+			fprintf(f, " %13s", "n/a");
+		else
+			fprintf(f, " %13.2f", total[p][CNT_CACHEMISS] / kb);
+		fprintf(f, "\n");
+	}
+}
@@ -41,18 +41,38 @@
 	} \
 } while(0)
 
-void print_attr(struct attr_elem *a, int);
-void print_elem(struct dom_elem *e, int, int, char *);
-void print_attr2(struct attr_elem *a, int);
-void print_elem2(struct dom_elem *e, int);
+void print_attr(struct domhead *, struct attr_elem *a, int);
+void print_attr2(struct domhead *, struct attr_elem *a, int);
+void print_elem2(struct domhead *, struct dom_elem *e, int);
 void print_elem_flags(struct dom_elem *e);
 int is_match(int match, int fmatch, int flags);
+static void print_node(struct domhead *, struct dom_elem *, int, int, char *);
+static int has_end(struct dom_elem *, int);
+static void print_end(struct domhead *, struct dom_elem *, int, int);
+static void print_list(struct domhead *, int, char *);
+static void print_cut(struct domhead *, int);
+static void print_label(struct domhead *, struct dom_elem *, int);
+
+/* the query being printed, see print_query() */
+static uint16_t qmask = QUERY_BIT(0);
+static const char *qlabel;
+static int qdepth;			/* of the root's children, for -p */
 
 const char *elem_type_str[] = {
 	"DOCTYPE",
 	"ELEMENT",
 	"TEXT",
-	"COMMENT"
+	"COMMENT",
+	"ROOT"
+};
+
+/* the name -x shows for nodes that are not elements */
+static const char *node_name_str[] = {
+	"doctype",
+	NULL,
+	"TEXT",
+	"COMMENT",
+	"ROOT"
 };
 
 const char *sel_op_str[] = {
@@ -62,7 +82,8 @@ const char *sel_op_str[] = {
 	"EQ or START",
 	"START",
 	"END",
-	"SUBSTR"
+	"SUBSTR",
+	"REGEX"
 };
 
 const char *elem_op_str[] = {
@@ -97,50 +118,91 @@ is_match(int match, int fmatch, int flags)
 }
 
 void
-print_attr(struct attr_elem *a, int flags)
+print_attr(struct domhead *dh, struct attr_elem *a, int flags)
 {
-	printf("%s",a->key);
-	if (a->value != NULL)
-		printf("=\"%s\"",a->value);
+	const char *v;
+	size_t len;
+
+	printf("%.*s",(int)a->key.len,DOM_STR(dh,a->key));
+	if (a->value.off == 0)
+		return;
+	/* attribute output (-a) is decoded, html output is left as is */
+	if (flags & FLAG_ATTR) {
+		v = attr_value(dh, a, &len);
+		printf("=\"%.*s\"",(int)len,v);
+	} else
+		printf("=\"%.*s\"",(int)a->value.len,DOM_STR(dh,a->value));
 	return;
 }
 void
-print_elem(struct dom_elem *e, int flags, int rec, char *attr)
+print_elem(struct domhead *dh, struct dom_elem *e, int flags, int rec, char *attr)
 {
-	struct attr_elem *a;
 	struct dom_elem *c;
 
+	print_node(dh, e, flags, rec, attr);
+	DOM_FOREACH_CHILD(c, dh, e) {
+		print_elem(dh, c, flags, rec+1, attr);
+	}
+	print_end(dh, e, flags, rec);
+}
+
+/* the node itself, its children and end tag are left to the caller */
+static void
+print_node(struct domhead *dh, struct dom_elem *e, int flags, int rec,
+    char *attr)
+{
+	struct attr_elem *a;
+	const char *v;
+	char *t;
+	size_t len;
+
 	if (!((flags & FLAG_TEXT) || (flags & FLAG_COMMENT) || (flags & FLAG_ATTR))) {
 		PRETTY_INDENT(flags,rec);
 	}
 	switch(e->type) {
 		case DOMF_DOCT:
-			if ( is_match(e->match, FLAG_ELEM, flags) && ! (flags & FLAG_ATTR)) {
-				printf("<!DOCTYPE %s>\n",e->value);
+			if ( is_match(e->match & qmask, FLAG_ELEM, flags) && ! (flags & FLAG_ATTR)) {
+				print_label(dh, e, flags);
+				printf("<!DOCTYPE %.*s>\n",(int)e->value.len,DOM_STR(dh,e->value));
 			}
 			break;
 		case DOMF_COMM:
-			if ( is_match(e->match, FLAG_COMMENT, flags) && ! (flags & FLAG_ATTR)) {
-				printf("<!-- %s -->\n",e->value);
+			if ( is_match(e->match & qmask, FLAG_COMMENT, flags) && ! (flags & FLAG_ATTR)) {
+				print_label(dh, e, flags);
+				printf("<!-- %.*s -->\n",(int)e->value.len,DOM_STR(dh,e->value));
 			}
 			break;
 		case DOMF_TEXT:
-			if ( is_match(e->match, FLAG_TEXT, flags) && ! (flags & FLAG_ATTR)) {
+			if ( is_match(e->match & qmask, FLAG_TEXT, flags) && ! (flags & FLAG_ATTR)) {
+				print_label(dh, e, flags);
+				/* text output (-t) is decoded, html output is left as is */
+				if (flags & FLAG_TEXT)
+					v = text_value(dh, e, &len);
+				else {
+					v = DOM_STR(dh, e->value);
+					len = e->value.len;
+				}
 				if (flags & FLAG_PRETTY) {
-					clean_str(e->value);
+					if ((t = strndup(v, len)) == NULL)
+						err(1, "strndup");
+					printf("%s\n",clean_str(t));
+					free(t);
+				} else {
+					printf("%.*s",(int)len,v);
+					/* keep labeled records on lines of their own */
+					if (qlabel != NULL && (len == 0 || v[len - 1] != '\n'))
+						printf("\n");
 				}
-				printf("%s",e->value);
-				if (flags & FLAG_PRETTY)
-					printf("\n");
 			}
 			break;
 		case DOMF_ELEM:
-			if ( is_match(e->match, FLAG_ELEM, flags)) {
+			if ( is_match(e->match & qmask, FLAG_ELEM, flags)) {
 				if (! (flags & FLAG_ATTR)) {
-					printf("<%s",e->name);
-					TAILQ_FOREACH(a, &e->attrs, next) {
+					print_label(dh, e, flags);
+					printf("<%.*s",(int)e->name.len,DOM_STR(dh,e->name));
+					DOM_FOREACH_ATTR(a, dh, e) {
 						printf(" ");
-						print_attr(a, flags);
+						print_attr(dh, a, flags);
 					}
 					if (e->flags & ELEM_INLINE) {
 						printf(" />\n");
@@ -155,9 +217,11 @@ print_elem(struct dom_elem *e, int flags, int rec, char *attr)
 					if ((s = strdup(attr)) == NULL)
 						err(1,"strdup");
 					for ((p = strtok_r(s,",",&last)); p!=NULL; (p = strtok_r(NULL,",",&last))) {
-						TAILQ_FOREACH(a, &e->attrs, next) {
-							if (strcasecmp(p, a->key) == 0) {
-								print_attr(a,flags);
+						DOM_FOREACH_ATTR(a, dh, e) {
+							if (span_strcasecmp(dh, a->key, p) == 0) {
+								if (f == 0)
+									print_label(dh, e, flags);
+								print_attr(dh,a,flags);
 								printf(" ");
 								f = 1;
 							}
@@ -173,69 +237,206 @@ print_elem(struct dom_elem *e, int flags, int rec, char *attr)
 		default:
 			break;
 	}
-	TAILQ_FOREACH(c, &e->children, next) {
-		print_elem(c, flags, rec+1, attr);
-	}
-	if ( is_match(e->match, FLAG_ELEM, flags) && ! (flags & FLAG_ATTR)) {
-		if (e->type == DOMF_ELEM) {
-			if (unterminated_element(e->name) == 0) {
-				if (! (e->flags & ELEM_INLINE)) {
-					PRETTY_INDENT(flags,rec);
-					printf("</%s>\n",e->name);
-				}
-			}
-		}
+}
+
+/* 1 if the end tag of e is printed */
+static int
+has_end(struct dom_elem *e, int flags)
+{
+	return(e->type == DOMF_ELEM && !(flags & FLAG_ATTR) &&
+	    !(e->flags & (ELEM_NOEND|ELEM_INLINE)) &&
+	    is_match(e->match & qmask, FLAG_ELEM, flags));
+}
+
+static void
+print_end(struct domhead *dh, struct dom_elem *e, int flags, int rec)
+{
+	if (has_end(e, flags)) {
+		PRETTY_INDENT(flags,rec);
+		printf("</%.*s>\n",(int)e->name.len,DOM_STR(dh,e->name));
 	}
 }
 
 void
-print_attr2(struct attr_elem *a, int flags)
+print_attr2(struct domhead *dh, struct attr_elem *a, int flags)
 {
 	printf("\t attribute:\n");
-	printf("\t\t key: %s\n",a->key);
-	printf("\t\t val: %s\n",a->value);
+	printf("\t\t key: %.*s\n",(int)a->key.len,DOM_STR(dh,a->key));
+	if (a->value.off == 0)
+		printf("\t\t val: (null)\n");
+	else
+		printf("\t\t val: %.*s\n",(int)a->value.len,DOM_STR(dh,a->value));
 }
 void
-print_elem2(struct dom_elem *e, int flags)
+print_elem2(struct domhead *dh, struct dom_elem *e, int flags)
 {
 	struct attr_elem *a;
-	struct dom_elem *c;
+	struct dom_elem *c, *p;
 	// print element info
-	printf("%s%s line %d\n",elem_type_str[e->type],(e->match==1?"*":""),e->line);
-	printf("\t name: %s\n",e->name);
-	if (is_top(e) || e->parent == NULL) {
+	printf("%s%s line %d\n",elem_type_str[e->type],((e->match & qmask)?"*":""),e->line);
+	if (e->type == DOMF_ELEM)
+		printf("\t name: %.*s\n",(int)e->name.len,DOM_STR(dh,e->name));
+	else
+		printf("\t name: %s\n",node_name_str[e->type]);
+	if (is_top(e)) {
 		printf("\t parent: top\n");
 	} else {
-		printf("\t parent: %s\n",e->parent->name);
+		p = DOM_NODE(dh, e->parent);
+		printf("\t parent: %.*s\n",(int)p->name.len,DOM_STR(dh,p->name));
 	}
 	printf("\t flags: "); print_elem_flags(e);
-	if (e->value != NULL) {
-		printf("\t value: %s\n",e->value);
+	if (e->type != DOMF_ELEM) {
+		printf("\t value: %.*s\n",(int)e->value.len,DOM_STR(dh,e->value));
 	}
 	// print all attributes
-	TAILQ_FOREACH(a, &e->attrs, next) {
-		print_attr2(a, flags);
+	DOM_FOREACH_ATTR(a, dh, e) {
+		print_attr2(dh, a, flags);
 	}
 	// print children
-	TAILQ_FOREACH(c, &e->children, next) {
-		print_elem2(c, flags);
+	DOM_FOREACH_CHILD(c, dh, e) {
+		print_elem2(dh, c, flags);
 	}
 }
 
+/* -p indents a dom of part of a document as at depth in all of it */
+void
+print_indent(int depth)
+{
+	qdepth = depth;
+}
+
 void
 print_dom(struct domhead *dh, int flags, char *attr)
+{
+	print_query(dh, flags, attr, QUERY_BIT(0), NULL);
+}
+
+/*
+ * print the nodes matched by the queries in mask.  With a label each
+ * record, a printed node whose parent is not, starts with it.  Only the
+ * list of matched nodes is visited unless the rest of the dom is wanted,
+ * as with -x.  Plain -d copies the input around the deleted nodes.
+ */
+void
+print_query(struct domhead *dh, int flags, char *attr, uint16_t mask,
+    const char *label)
 {
 	struct dom_elem *e;
 
-	TAILQ_FOREACH(e, dh, next) {
+	qmask = mask;
+	qlabel = label;
+	if (dh->mlist != NULL && !(flags & (FLAG_DEL|FLAG_X))) {
+		print_list(dh, flags, attr);
+		return;
+	}
+	if (dh->mlist != NULL && (flags & FLAG_DEL) &&
+	    !(flags & (FLAG_PRETTY|FLAG_ATTR|FLAG_X))) {
+		print_cut(dh, flags);
+		return;
+	}
+	DOM_FOREACH_CHILD(e, dh, DOM_NODE(dh, DOM_ROOT)) {
 		if (flags & FLAG_X)
-			print_elem2(e,flags);
+			print_elem2(dh,e,flags);
 		else
-			print_elem(e,flags,0,attr);
+			print_elem(dh,e,flags,qdepth,attr);
 	}
 	return;
 }
 
+/*
+ * the same output as print_elem() over the whole dom, where a node that
+ * is not matched prints nothing.  The elements whose end tag is due are
+ * kept on a stack and closed once the list leaves their subtree.
+ */
+static void
+print_list(struct domhead *dh, int flags, char *attr)
+{
+	static struct {
+		uint32_t	i;
+		int			rec;
+	} *open;
+	static uint32_t opensz;
+	struct dom_elem *e;
+	uint32_t k, i, j, pi = DOM_ROOT, n = 0;
+	int rec, prec = qdepth - 1;
+	void *p;
+
+	for (k = 0; k < dh->nmlist; k++) {
+		i = dh->mlist[k];
+		e = DOM_NODE(dh, i);
+		if ((e->match & qmask) == 0)
+			continue;
+		for (; n > 0 && i > DOM_NODE(dh, open[n - 1].i)->end; n--)
+			print_end(dh, DOM_NODE(dh, open[n - 1].i), flags,
+			    open[n - 1].rec);
+		/* most nodes follow their parent or a sibling */
+		if (e->parent == pi)
+			rec = prec + 1;
+		else if (e->parent == DOM_NODE(dh, pi)->parent)
+			rec = prec;
+		else {
+			for (rec = qdepth, j = e->parent; j != DOM_ROOT;
+			    j = DOM_NODE(dh, j)->parent)
+				rec++;
+		}
+		pi = i;
+		prec = rec;
+		print_node(dh, e, flags, rec, attr);
+		if (!has_end(e, flags))
+			continue;
+		if (n == opensz) {
+			opensz = opensz ? opensz * 2 : 64;
+			if ((p = reallocarray(open, opensz, sizeof(*open))) == NULL)
+				err(1, "reallocarray");
+			open = p;
+		}
+		open[n].i = i;
+		open[n++].rec = rec;
+	}
+	for (; n > 0; n--)
+		print_end(dh, DOM_NODE(dh, open[n - 1].i), flags, open[n - 1].rec);
+}
+
+/*
+ * the input less the bytes of the nodes -d deletes: the tags of an
+ * element, or all of a text or comment.  What is left is written as it
+ * was read, in the runs between the cuts.
+ */
+static void
+print_cut(struct domhead *dh, int flags)
+{
+	struct dom_elem *e;
+	struct span tag, etag;
+	uint32_t k;
+	int f;
+
+	for (k = 0; k < dh->nmlist; k++) {
+		e = DOM_NODE(dh, dh->mlist[k]);
+		if ((e->match & qmask) == 0)
+			continue;
+		f = e->type == DOMF_TEXT ? FLAG_TEXT :
+		    e->type == DOMF_COMM ? FLAG_COMMENT : FLAG_ELEM;
+		if (!is_match(e->match & qmask, f, flags & ~FLAG_DEL))
+			continue;
+		node_span(dh, e, &tag, &etag);
+		splice_add(tag.off, tag.len, "", 0);
+		if (etag.len != 0)
+			splice_add(etag.off, etag.len, "", 0);
+	}
+	splice_write(dh);
+}
+
+static void
+print_label(struct domhead *dh, struct dom_elem *e, int flags)
+{
+	if (qlabel == NULL)
+		return;
+	if (e->parent != DOM_ROOT && !(flags & FLAG_ATTR) &&
+	    is_match(DOM_NODE(dh, e->parent)->match & qmask, FLAG_ELEM, flags))
+		return;
+	printf("%s\t", qlabel);
+}
+
 void
 print_elem_flags(struct dom_elem *e)
 {
@@ -263,6 +464,7 @@ print_sel(struct selhead *sh)
 {
 	struct sel *s;
 	struct sel_attr *a;
+	struct sel_pseudo *p;
 
 	TAILQ_FOREACH(s, sh, next) {
 		switch(s->op) {
@@ -281,14 +483,15 @@ print_sel(struct selhead *sh)
 				break;
 		}
 		printf("%s",s->elem);
-		if ((a = find_attr(s,"class")) != NULL) {
-			printf(".%s",a->val);
+		TAILQ_FOREACH(a, &s->attrs, next) {
+			if (strcasecmp("class",a->name) == 0 && a->op == OP_CONTAINS)
+				printf(".%s",a->val);
 		}
 		if ((a = find_attr(s,"id")) != NULL) {
 			printf("#%s",a->val);
 		}
 		TAILQ_FOREACH(a, &s->attrs, next) {
-			if (strcasecmp("class",a->name) == 0)
+			if (strcasecmp("class",a->name) == 0 && a->op == OP_CONTAINS)
 				continue;
 			if (strcasecmp("id",a->name) == 0)
 				continue;
@@ -306,10 +509,18 @@ print_sel(struct selhead *sh)
 					printf("$="); break;
 				case OP_SUBSTR:
 					printf("*="); break;
+				case OP_REGEX:
+					printf("=~"); break;
 				default:
 					break;
 			}
-			printf("%s]",a->val);
+			printf("%s%s]",a->val,(a->flags & SATTR_CASE) ? " s" : "");
+		}
+		TAILQ_FOREACH(p, &s->pseudos, next) {
+			if (p->arg != NULL)
+				printf(":%s(%s)",p->name,p->arg);
+			else
+				printf(":%s",p->name);
 		}
 	}
 	printf("\n");
@@ -0,0 +1,30 @@
+#!/bin/sh
+#
+# the compound left of > is matched whole, the same as inside :is() and
+# with several selectors.  usage: child.sh [hq]
+
+HQ=${1:-./hq}
+DOC='<html><body><div><p>a</p><p>b</p></div><div class="box"><p>c</p></div><p>d</p></body></html>'
+fail=0
+
+check()
+{
+	got=$(printf '%s' "$DOC" | $HQ -t "$1")
+	if [ "$got" != "$2" ]; then
+		echo "FAIL: -t '$1': got '$got', expected '$2'"
+		fail=1
+	fi
+}
+
+check 'div > p'			abc
+check 'body > p'		d
+check 'div.box > p'		c
+check '.box > p'		c
+check ':is(.box > p)'		c
+check 'div.nothere > p'		''
+check ':is(div.nothere > p)'	''
+check 'div:not(.box) > p'	ab
+check 'div[class] > p'		c
+check 'div:first-child > p'	ab
+
+exit $fail
@@ -0,0 +1,32 @@
+#!/bin/sh
+#
+# -s, -u, -T and -w write the input with the changes made.  The last
+# edit of one attribute, or of the text, is the one made.
+# usage: edit.sh [hq]
+
+HQ=${1:-./hq}
+DOC='<p><a href="x">old</a><b>keep</b></p>'
+fail=0
+
+# check EXPECTED OPTION...
+check()
+{
+	want=$1
+	shift
+	got=$(printf '%s' "$DOC" | $HQ "$@" a)
+	if [ "$got" != "$want" ]; then
+		echo "FAIL: $*: got '$got', expected '$want'"
+		fail=1
+	fi
+}
+
+check '<p><a href="one">old</a><b>keep</b></p>'	-s href=one
+check '<p><a href="two">old</a><b>keep</b></p>'	-s href=one -s href=two
+check '<p><a href="x" id="2">old</a><b>keep</b></p>'	-s id=1 -s id=2
+check '<p><a>old</a><b>keep</b></p>'		-s href=one -u href
+check '<p><a HREF="one">old</a><b>keep</b></p>'	-u href -s HREF=one
+check '<p><a href="x">two</a><b>keep</b></p>'	-T one -T two
+check '<p><a href="one">two</a><b>keep</b></p>'	-T two -s href=one
+check '<p>one<b>keep</b></p>'			-T one -w -w
+
+exit $fail
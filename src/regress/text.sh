@@ -0,0 +1,37 @@
+#!/bin/sh
+#
+# -t and -c take the text and comments of the matched elements.  Only a
+# bare * or empty selector takes all of them, a compound with attributes
+# or pseudo-classes is matched as it is, and :is(a, b) as a, b.
+# usage: text.sh [hq]
+
+HQ=${1:-./hq}
+DOC='<html><body><h1>Shop</h1><ul><li>A</li><li class="x">B</li></ul><table><tr><td>1</td><td>2</td></tr></table><p>Nice <b>bold</b><!--c1--></p><div><!--c2--></div></body></html>'
+fail=0
+
+check()
+{
+	got=$(printf '%s' "$DOC" | $HQ $1 "$2" | tr -d '\n')
+	if [ "$got" != "$3" ]; then
+		echo "FAIL: $1 '$2': got '$got', expected '$3'"
+		fail=1
+	fi
+}
+
+check -t '*'			'ShopAB12Nice bold'
+check -t ''			'ShopAB12Nice bold'
+check -t '.x'			B
+check -t '[class]'		B
+check -t ':first-child'		'ShopA1bold'
+check -t ':contains(Nice)'	'Nice '
+check -t 'li, td'		AB12
+check -t ':is(li, td)'		AB12
+check -t ':where(li)'		AB
+check -t ':not(li)'		'Shop12Nice bold'
+check -c '*'			'<!-- c1 --><!-- c2 -->'
+check -c 'div'			'<!-- c2 -->'
+check -c ':is(div)'		'<!-- c2 -->'
+check -c ':first-child'		''
+check -c ':not(p)'		'<!-- c2 -->'
+
+exit $fail
@@ -0,0 +1,235 @@
+/* $Id$ */
+/*
+ * Copyright (c) 2024 Michael Graves
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * the regular expressions of [attr=~"re"] and :contains-re(re).  They are
+ * POSIX extended expressions compiled once with the selector.  Most
+ * values are turned away before regexec(3) by a literal every match must
+ * hold, found in the expression when it is compiled.
+ */
+
+#include "config.h"
+
+#if HAVE_SYS_QUEUE
+#include <sys/queue.h>
+#endif
+
+#if HAVE_ERR
+#include <err.h>
+#endif
+#include <ctype.h>
+#include <regex.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hq.h"
+
+struct sel_re {
+	regex_t	re;
+	char	*lit;		/* in every match, folded unless exact */
+	size_t	nlit;
+	int		anchored;	/* lit starts the value */
+	int		exact;
+};
+
+static size_t rx_skip(const char *, size_t);
+static void rx_literal(struct sel_re *, const char *);
+
+/* past the [ ] or ( ) at i */
+static size_t
+rx_skip(const char *s, size_t i)
+{
+	int depth = 0;
+
+	if (s[i] == '[') {
+		i++;
+		if (s[i] == '^')
+			i++;
+		if (s[i] == ']')
+			i++;
+		for (; s[i] != '\0' && s[i] != ']'; i++) {
+			/* [:alpha:] and the like */
+			if (s[i] == '[' && (s[i + 1] == ':' || s[i + 1] == '.' ||
+			    s[i + 1] == '=')) {
+				for (i += 2; s[i] != '\0' && s[i] != ']'; i++)
+					;
+				if (s[i] == '\0')
+					return(i);
+			}
+		}
+		return(s[i] == '\0' ? i : i + 1);
+	}
+	for (; s[i] != '\0'; i++) {
+		if (s[i] == '\\' && s[i + 1] != '\0')
+			i++;
+		else if (s[i] == '[')
+			i = rx_skip(s, i) - 1;
+		else if (s[i] == '(')
+			depth++;
+		else if (s[i] == ')' && --depth == 0)
+			return(i + 1);
+	}
+	return(i);
+}
+
+/*
+ * the longest run of plain characters outside any group, bracket or
+ * optional repeat.  An expression with | has none since either side may
+ * match alone.
+ */
+static void
+rx_literal(struct sel_re *r, const char *pat)
+{
+	char *run;
+	size_t i = 0, n = 0, st = 0, len = strlen(pat);
+	int c;
+
+	if (strchr(pat, '|') != NULL)
+		return;
+	if ((run = malloc(len + 1)) == NULL)
+		err(1, "malloc");
+	if (pat[0] == '^')
+		i = st = 1;
+	for (;;) {
+		c = pat[i];
+		if (c == '*' || c == '?' || c == '{') {
+			/* the last one may be left out */
+			if (n > 0)
+				n--;
+		} else if (c == '\\' && pat[i + 1] != '\0' &&
+		    strchr(".[]()*+?{}|^$\\/", pat[i + 1]) != NULL) {
+			run[n++] = pat[i + 1];
+			i += 2;
+			continue;
+		} else if (c != '\0' && c != '\\' && c != '+' &&
+		    strchr(".^$[]()", c) == NULL) {
+			run[n++] = c;
+			i++;
+			continue;
+		}
+		/* the run ends here */
+		if (n > r->nlit) {
+			free(r->lit);
+			if ((r->lit = strndup(run, n)) == NULL)
+				err(1, "strndup");
+			r->nlit = n;
+			r->anchored = (st == 1 && pat[0] == '^');
+		}
+		n = 0;
+		if (c == '\0')
+			break;
+		if (c == '[' || c == '(')
+			i = rx_skip(pat, i);
+		else if (c == '{') {
+			while (pat[i] != '\0' && pat[i] != '}')
+				i++;
+			if (pat[i] != '\0')
+				i++;
+		} else
+			i += (c == '\\' && pat[i + 1] != '\0') ? 2 : 1;
+		st = i;
+	}
+	free(run);
+	if (!r->exact) {
+		for (i = 0; i < r->nlit; i++)
+			r->lit[i] = tolower((unsigned char)r->lit[i]);
+	}
+}
+
+/* NULL with a warning if pat does not compile */
+struct sel_re *
+rx_compile(const char *pat, int exact)
+{
+	struct sel_re *r;
+	char buf[128];
+	int rc;
+
+	if ((r = calloc(1, sizeof(*r))) == NULL)
+		err(1, "calloc");
+	alloc_bytes += sizeof(*r);
+	r->exact = exact;
+	if ((rc = regcomp(&r->re, pat, REG_EXTENDED | REG_NOSUB |
+	    (exact ? 0 : REG_ICASE))) != 0) {
+		regerror(rc, &r->re, buf, sizeof(buf));
+		warnx("bad regular expression %s: %s", pat, buf);
+		free(r);
+		return(NULL);
+	}
+	rx_literal(r, pat);
+	return(r);
+}
+
+/* the literal every match holds, for a prefilter of one's own */
+const char *
+rx_lit(struct sel_re *r, size_t *len)
+{
+	*len = r->nlit;
+	return(r->lit);
+}
+
+/* v need not end in a NUL */
+int
+rx_exec(struct sel_re *r, const char *v, size_t len)
+{
+#ifdef REG_STARTEND
+	regmatch_t m;
+
+	m.rm_so = 0;
+	m.rm_eo = len;
+	return(regexec(&r->re, v, 1, &m, REG_STARTEND) == 0);
+#else
+	static char *buf;
+	static size_t bufsz;
+	char *p;
+
+	if (len + 1 > bufsz) {
+		if ((p = realloc(buf, len + 1)) == NULL)
+			err(1, "realloc");
+		buf = p;
+		bufsz = len + 1;
+	}
+	memcpy(buf, v, len);
+	buf[len] = '\0';
+	return(regexec(&r->re, buf, 0, NULL, 0) == 0);
+#endif
+}
+
+int
+rx_match(struct sel_re *r, const char *v, size_t len)
+{
+	if (r->nlit != 0) {
+		if (r->nlit > len)
+			return(0);
+		/* ^lit: only the start can hold it */
+		if (needle_find(v, r->anchored ? r->nlit : len, r->lit,
+		    r->nlit, r->exact) == NULL)
+			return(0);
+	}
+	return(rx_exec(r, v, len));
+}
+
+void
+rx_free(struct sel_re *r)
+{
+	if (r == NULL)
+		return;
+	regfree(&r->re);
+	free(r->lit);
+	free(r);
+}
@@ -78,12 +78,51 @@
 
 
 int                     yylex(void);
+static struct sel_pseudo *new_pseudo(char *, char *);
+static int nth_parse(const char *, int *, int *);
+static int parse_args(struct selhead *);
+
+static int inarg;		/* the next token is the argument in ( ) */
+
+#define ARG_NONE	0
+#define ARG_NTH		1		/* an+b */
+#define ARG_SEL		2		/* a selector, see parse_args() */
+#define ARG_TEXT	3		/* a string, quoted or not */
+
+/* the :first ones are :nth with a fixed an+b */
+static const struct {
+	const char	*name;
+	int			 type;
+	int			 arg;
+	int			 a;
+	int			 b;
+} pseudo_types[] = {
+	{ "first-child",		PS_NTH_CHILD,			ARG_NONE,	0,	1 },
+	{ "last-child",			PS_NTH_LAST_CHILD,		ARG_NONE,	0,	1 },
+	{ "only-child",			PS_ONLY_CHILD,			ARG_NONE,	0,	0 },
+	{ "first-of-type",		PS_NTH_OF_TYPE,			ARG_NONE,	0,	1 },
+	{ "last-of-type",		PS_NTH_LAST_OF_TYPE,	ARG_NONE,	0,	1 },
+	{ "only-of-type",		PS_ONLY_OF_TYPE,		ARG_NONE,	0,	0 },
+	{ "root",				PS_ROOT,				ARG_NONE,	0,	0 },
+	{ "empty",				PS_EMPTY,				ARG_NONE,	0,	0 },
+	{ "nth-child",			PS_NTH_CHILD,			ARG_NTH,	0,	0 },
+	{ "nth-last-child",		PS_NTH_LAST_CHILD,		ARG_NTH,	0,	0 },
+	{ "nth-of-type",		PS_NTH_OF_TYPE,			ARG_NTH,	0,	0 },
+	{ "nth-last-of-type",	PS_NTH_LAST_OF_TYPE,	ARG_NTH,	0,	0 },
+	{ "has",				PS_HAS,					ARG_SEL,	0,	0 },
+	{ "is",					PS_IS,					ARG_SEL,	0,	0 },
+	{ "where",				PS_IS,					ARG_SEL,	0,	0 },
+	{ "not",				PS_NOT,					ARG_SEL,	0,	0 },
+	{ "contains",			PS_CONTAINS,			ARG_TEXT,	0,	0 },
+	{ "contains-re",		PS_CONTAINS_RE,			ARG_TEXT,	0,	0 },
+};
 
 typedef struct {
         union {
                 int64_t         number;
                 char            *string;
 				struct sel_attr	*attr;
+				struct sel_pseudo	*pseudo;
 				struct sel		*el;
         } v;
 } YYSTYPE;
@@ -92,11 +131,15 @@ struct selhead *selhead;
 
 %}
 %token  <v.string>      STRING
+%token  <v.string>      ARG
 %type	<v.number>		op;
+%type	<v.number>		attrflag;
 %type	<v.attr>		filter;
 %type	<v.attr>		class;
 %type	<v.attr>		id;
+%type	<v.pseudo>		pseudo;
 %type	<v.el>			element;
+%type	<v.el>			classes;
 
 
 %%
@@ -161,12 +204,9 @@ element		: '*' {
 				TAILQ_INSERT_TAIL(&s->attrs, $1, next);
 				$$ = s;
 			}
-			| class {
-				struct sel *s;
-				s = alloc_sel();
-				s->elem = strdup("*");
-				TAILQ_INSERT_TAIL(&s->attrs, $1, next);
-				$$ = s;
+			| classes {
+				$1->elem = strdup("*");
+				$$ = $1;
 			}
 			| filter {
 				struct sel *s;
@@ -175,13 +215,10 @@ element		: '*' {
 				TAILQ_INSERT_TAIL(&s->attrs, $1, next);
 				$$ = s;
 			}
-			| class filter {
-				struct sel *s;
-				s = alloc_sel();
-				s->elem = strdup("*");
-				TAILQ_INSERT_TAIL(&s->attrs, $1, next);
-				TAILQ_INSERT_TAIL(&s->attrs, $2, next);
-				$$ = s;
+			| classes filter {
+				$1->elem = strdup("*");
+				TAILQ_INSERT_TAIL(&$1->attrs, $2, next);
+				$$ = $1;
 			}
 			| STRING {
 				struct sel *s;
@@ -196,35 +233,60 @@ element		: '*' {
 				TAILQ_INSERT_TAIL(&s->attrs, $2, next);
 				$$ = s;
 			}
-			| STRING class {
+			| STRING classes {
+				$2->elem = $1;
+				$$ = $2;
+			}
+			| STRING filter {
 				struct sel *s;
 				s = alloc_sel();
 				s->elem = $1;
 				TAILQ_INSERT_TAIL(&s->attrs, $2, next);
 				$$ = s;
 			}
-			| STRING filter {
+			| STRING classes filter {
+				$2->elem = $1;
+				TAILQ_INSERT_TAIL(&$2->attrs, $3, next);
+				$$ = $2;
+			}
+			| pseudo {
 				struct sel *s;
 				s = alloc_sel();
-				s->elem = $1;
-				TAILQ_INSERT_TAIL(&s->attrs, $2, next);
+				s->elem = strdup("*");
+				TAILQ_INSERT_TAIL(&s->pseudos, $1, next);
 				$$ = s;
 			}
-			| STRING class filter {
+			| element pseudo {
+				TAILQ_INSERT_TAIL(&$1->pseudos, $2, next);
+				$$ = $1;
+			}
+			;
+
+pseudo		: ':' STRING {
+				$$ = new_pseudo($2, NULL);
+			}
+			| ':' STRING '(' ARG ')' {
+				$$ = new_pseudo($2, $4);
+			}
+			;
+
+classes		: class {
 				struct sel *s;
 				s = alloc_sel();
-				s->elem = $1;
-				TAILQ_INSERT_TAIL(&s->attrs, $2, next);
-				TAILQ_INSERT_TAIL(&s->attrs, $3, next);
+				TAILQ_INSERT_TAIL(&s->attrs, $1, next);
 				$$ = s;
 			}
+			| classes class {
+				TAILQ_INSERT_TAIL(&$1->attrs, $2, next);
+				$$ = $1;
+			}
 			;
 
 class		: '.' STRING {
 	 			struct sel_attr *s;
 				s = alloc_sel_attr();
 				s->name = strdup("class");
-				s->op = OP_MATCH;
+				s->op = OP_CONTAINS;		/* same as [class~=x] */
 				s->val = $2;
 	   			$$ = s;
 			}
@@ -234,7 +296,7 @@ id			: '#' STRING {
 	 			struct sel_attr *s;
 				s = alloc_sel_attr();
 				s->name = strdup("id");
-				s->op = OP_MATCH;
+				s->op = OP_EQ;
 				s->val = $2;
 	 			$$ = s;
 	 		}
@@ -247,42 +309,219 @@ filter		: '[' STRING ']' {
 				s->op = OP_MATCH;
 				$$ = s;
 			}
-			| '[' STRING op STRING ']'{
+			| '[' STRING op STRING attrflag ']'{
 				struct sel_attr *s;
 				s = alloc_sel_attr();
 				s->name = $2;
 				s->val = $4;
 				s->op = $3;
+				s->flags = $5;
 				$$ = s;
 			}
-			| '[' STRING op '"' STRING '"' ']'{
+			| '[' STRING op '"' STRING '"' attrflag ']'{
 				struct sel_attr *s;
 				s = alloc_sel_attr();
 				s->name = $2;
 				s->val = $5;
 				s->op = $3;
+				s->flags = $7;
 				$$ = s;
 			}
 			;
 
+attrflag	: /* empty */ { $$ = 0; }
+			| ' ' STRING {
+				/* i is what hq does anyway */
+				if (strcasecmp($2, "s") == 0)
+					$$ = SATTR_CASE;
+				else if (strcasecmp($2, "i") == 0)
+					$$ = 0;
+				else {
+					yyerror("bad attribute flag %s", $2);
+					$$ = 0;
+				}
+				free($2);
+			}
+			;
+
 op			: '=' { $$ = OP_EQ; }
 	 		| '~' '=' { $$ = OP_CONTAINS; }
 	 		| '|' '=' { $$ = OP_EQ_START; }
 	 		| '^' '=' { $$ = OP_START; }
 	 		| '$' '=' { $$ = OP_END; }
 	 		| '*' '=' { $$ = OP_SUBSTR; }
+	 		| '=' '~' { $$ = OP_REGEX; }
 			;
 
 %%
 
+static struct sel_pseudo *
+new_pseudo(char *name, char *arg)
+{
+	struct sel_pseudo *p;
+	size_t i;
+
+	p = alloc_sel_pseudo();
+	p->name = name;
+	p->arg = arg;
+	for (i = 0; i < sizeof(pseudo_types)/sizeof(pseudo_types[0]); i++) {
+		if (strcasecmp(name, pseudo_types[i].name) == 0)
+			break;
+	}
+	if (i == sizeof(pseudo_types)/sizeof(pseudo_types[0])) {
+		yyerror("unknown pseudo-class :%s", name);
+		return(p);
+	}
+	p->type = pseudo_types[i].type;
+	p->a = pseudo_types[i].a;
+	p->b = pseudo_types[i].b;
+	if ((pseudo_types[i].arg != ARG_NONE) != (arg != NULL))
+		yyerror(":%s %s an argument", name,
+		    arg != NULL ? "does not take" : "needs");
+	else if (pseudo_types[i].arg == ARG_NTH &&
+	    nth_parse(arg, &p->a, &p->b) == -1)
+		yyerror("bad argument :%s(%s)", name, arg);
+	return(p);
+}
+
+/* odd, even, b, an, an+b or an-b with optional spaces around the sign */
+static int
+nth_parse(const char *s, int *a, int *b)
+{
+	const char *errstr;
+	char num[16];
+	size_t n;
+	int sign = 1;
+
+	while (*s == ' ')
+		s++;
+	if (strncasecmp(s, "odd", 3) == 0 || strncasecmp(s, "even", 4) == 0) {
+		*a = 2;
+		*b = (s[0] == 'o' || s[0] == 'O') ? 1 : 0;
+		s += (*b ? 3 : 4);
+		while (*s == ' ')
+			s++;
+		return(*s == '\0' ? 0 : -1);
+	}
+	*a = 0;
+	*b = 0;
+	if (*s == '-' || *s == '+')
+		sign = (*s++ == '-') ? -1 : 1;
+	for (n = 0; isdigit((unsigned char)s[n]) && n < sizeof(num) - 1; n++)
+		num[n] = s[n];
+	num[n] = '\0';
+	s += n;
+	if (*s == 'n' || *s == 'N') {
+		*a = sign * (n ? strtonum(num, 0, INT_MAX, &errstr) : 1);
+		if (n && errstr != NULL)
+			return(-1);
+		s++;
+		while (*s == ' ')
+			s++;
+		if (*s == '\0')
+			return(0);
+		if (*s != '-' && *s != '+')
+			return(-1);
+		sign = (*s++ == '-') ? -1 : 1;
+		while (*s == ' ')
+			s++;
+		for (n = 0; isdigit((unsigned char)s[n]) && n < sizeof(num) - 1; n++)
+			num[n] = s[n];
+		num[n] = '\0';
+		s += n;
+	}
+	if (n == 0)
+		return(-1);
+	*b = sign * strtonum(num, 0, INT_MAX, &errstr);
+	if (errstr != NULL)
+		return(-1);
+	while (*s == ' ')
+		s++;
+	return(*s == '\0' ? 0 : -1);
+}
+
+/*
+ * the selectors in :has(), :is() and :not() are parsed once the outer one
+ * is done since the parser is not reentrant.  A leading combinator, only
+ * for :has(), is kept in rel.
+ */
+static int
+parse_args(struct selhead *sh)
+{
+	struct sel *s;
+	struct sel_pseudo *p;
+	char *a;
+	int rc = 0;
+
+	TAILQ_FOREACH(s, sh, next) {
+		TAILQ_FOREACH(p, &s->pseudos, next) {
+			if (p->type != PS_HAS && p->type != PS_IS &&
+			    p->type != PS_NOT)
+				continue;
+			for (a = p->arg; *a == ' '; a++)
+				;
+			switch (p->type == PS_HAS ? *a : '\0') {
+				case '>':
+					p->rel = EOP_PARENT;
+					break;
+				case '+':
+					p->rel = EOP_NEXT;
+					break;
+				case '~':
+					p->rel = EOP_PRECED;
+					break;
+				default:
+					p->rel = EOP_INSIDE;
+					break;
+			}
+			if (p->rel != EOP_INSIDE)
+				a++;
+			while (*a == ' ')
+				a++;
+			if (*a == '\0') {
+				rc++;
+				continue;
+			}
+			if ((p->sub = calloc(1, sizeof(*p->sub))) == NULL)
+				err(1, "calloc");
+			alloc_bytes += sizeof(*p->sub);
+			TAILQ_INIT(p->sub);
+			rc += parse_sel(p->sub, a);
+		}
+	}
+	return(rc);
+}
+
 int
 yylex(void)
 {
 	char *p, *st;
-	int c, quotec;
+	int c, quotec, depth;
 
 	st = p = raw_data + raw_off;
 	c = lgetc(0);
+	/* the raw argument of a pseudo-class, up to the closing ) */
+	if (inarg) {
+		inarg = 0;
+		for (depth = 0, quotec = 0; c != EOF &&
+		    (c != ')' || depth > 0 || quotec); p++) {
+			if (quotec) {
+				if (c == quotec)
+					quotec = 0;
+			} else if (c == '"' || c == '\'')
+				quotec = c;
+			else if (c == '(')
+				depth++;
+			else if (c == ')')
+				depth--;
+			c = lgetc(0);
+		}
+		if (c != EOF)
+			lungetc(c);
+		if ((yylval.v.string = extract_str(st,p)) == NULL)
+			fatal("%slex: extract_str",YYPREFIX);
+		return(ARG);
+	}
 //printf("c = '%c'\n",c);
 	/* end of buffer */
 	if (c == EOF) {
@@ -310,11 +549,13 @@ yylex(void)
 		return(' ');
 	}
 	/* if not alphanum just return */
-	if (!isalnum(c)) {
+	if (!isalnum(c) && c != '_') {
+		if (c == '(')
+			inarg = 1;
 		return(c);
 	}
-	/* unquoted string */
-	while (isalnum(c)) {
+	/* unquoted string, names may contain '-' and '_' */
+	while (isalnum(c) || c == '-' || c == '_') {
 //printf("c '%c' '%c'\n",c,*p);
 		p++;
 		c = lgetc(0);
@@ -329,14 +570,21 @@ yylex(void)
 int
 parse_sel(struct selhead *sh, char *raw)
 {
+	int rc;
+
 	if (sh == NULL || raw == NULL)
 		return(-1);
 	
 	selhead = sh;
 	init_buf(raw,strlen(raw));
 	errors = 0;
+	inarg = 0;
 
 	yyparse();
-	return(errors);
+	if ((rc = errors) == 0)
+		rc = parse_args(sh);
+	if (rc == 0)
+		rc = sel_compile(sh);
+	return(rc);
 }
 
@@ -0,0 +1,317 @@
+/* $Id$ */
+/*
+ * Copyright (c) 2024 Michael Graves
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * a set of many selectors matched as one.  Every rule is filed under a
+ * single key of its rightmost compound: the id, a class, an attribute
+ * name or the element name, in that order of preference.  A node is then
+ * only tried against the rules filed under the keys it carries plus the
+ * few without a key, so the cost per node stays about the same however
+ * many rules there are.  The left side of a combinator is checked by
+ * walking from the node, as browsers do, instead of the running state
+ * match_sel() keeps.
+ */
+
+#include "config.h"
+
+#if HAVE_SYS_QUEUE
+#include <sys/queue.h>
+#endif
+
+#if HAVE_ERR
+#include <err.h>
+#endif
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "hq.h"
+
+static int rule_key(struct sel *, const char **);
+static struct rule_bucket *bucket_find(struct selset *, int, uint32_t,
+    const char *, size_t);
+static void bucket_grow(struct selset *);
+static void rule_add(struct selset *, struct sel *, struct sel *);
+static int try_rules(struct domhead *, struct selset *, struct dom_elem *,
+    uint32_t);
+static int try_key(struct domhead *, struct selset *, struct dom_elem *, int,
+    uint32_t, const char *, size_t);
+static int node_match(struct domhead *, struct selset *, struct dom_elem *,
+    uint32_t);
+
+void
+selset_init(struct selset *ss)
+{
+	memset(ss, 0, sizeof(*ss));
+}
+
+/* the most selective key of the compound s */
+static int
+rule_key(struct sel *s, const char **key)
+{
+	struct sel_attr *a;
+	int kind = SKEY_ANY;
+
+	TAILQ_FOREACH(a, &s->attrs, next) {
+		if (a->op == OP_EQ && a->val != NULL && a->val[0] != '\0' &&
+		    strcasecmp(a->name, "id") == 0) {
+			*key = a->val;
+			return(SKEY_ID);
+		}
+		if (kind != SKEY_CLASS && a->op == OP_CONTAINS &&
+		    a->val != NULL && a->val[0] != '\0' &&
+		    strcasecmp(a->name, "class") == 0) {
+			*key = a->val;
+			kind = SKEY_CLASS;
+		} else if (kind == SKEY_ANY) {
+			*key = a->name;
+			kind = SKEY_ATTR;
+		}
+	}
+	if (kind == SKEY_ANY && strcmp(s->elem, "*") != 0 &&
+	    s->elem[0] != '\0') {
+		*key = s->elem;
+		kind = SKEY_TAG;
+	}
+	return(kind);
+}
+
+/* the bucket of the key, or the empty slot it would go in */
+static struct rule_bucket *
+bucket_find(struct selset *ss, int kind, uint32_t h, const char *key,
+    size_t len)
+{
+	struct rule_bucket *b;
+	uint32_t i;
+
+	for (i = h & (ss->nslots - 1); ; i = (i + 1) & (ss->nslots - 1)) {
+		b = &ss->slots[i];
+		if (b->first == 0)
+			return(b);
+		if (b->hash == h && b->kind == kind && b->keylen == len &&
+		    strncasecmp(b->key, key, len) == 0)
+			return(b);
+	}
+}
+
+static void
+bucket_grow(struct selset *ss)
+{
+	struct rule_bucket *old = ss->slots, *b;
+	uint32_t i, n = ss->nslots;
+
+	ss->nslots = n ? n * 2 : 256;
+	if ((ss->slots = calloc(ss->nslots, sizeof(*ss->slots))) == NULL)
+		err(1, "calloc");
+	alloc_bytes += ss->nslots * sizeof(*ss->slots);
+	for (i = 0; i < n; i++) {
+		if (old[i].first == 0)
+			continue;
+		b = bucket_find(ss, old[i].kind, old[i].hash, old[i].key,
+		    old[i].keylen);
+		*b = old[i];
+	}
+	free(old);
+}
+
+static void
+rule_add(struct selset *ss, struct sel *s, struct sel *left)
+{
+	struct rule_bucket *b;
+	struct rule *r;
+	const char *key = NULL;
+	uint32_t n, h, *first;
+	size_t len;
+	int kind;
+
+	if (ss->nrules == ss->rulesz) {
+		n = ss->rulesz ? ss->rulesz * 2 : 64;
+		if ((r = reallocarray(ss->rules, n, sizeof(*r))) == NULL)
+			err(1, "reallocarray");
+		alloc_bytes += (n - ss->rulesz) * sizeof(*r);
+		ss->rules = r;
+		ss->rulesz = n;
+	}
+	r = &ss->rules[ss->nrules++];
+	r->s = s;
+	r->left = left;
+
+	if ((kind = rule_key(s, &key)) == SKEY_ANY)
+		first = &ss->any;
+	else {
+		if (ss->nkeys * 2 >= ss->nslots)
+			bucket_grow(ss);
+		len = strlen(key);
+		h = atom_hash(key, len);
+		b = bucket_find(ss, kind, h, key, len);
+		if (b->first == 0) {
+			b->key = key;
+			b->keylen = len;
+			b->hash = h;
+			b->kind = kind;
+			ss->nkeys++;
+		}
+		first = &b->first;
+	}
+	/* chained by index + 1 so 0 ends the bucket */
+	r->next = *first;
+	*first = ss->nrules;
+}
+
+/*
+ * add the rules of a parsed selector.  sh is kept, not copied, and must
+ * outlive the set.  "a, b" is two rules.
+ */
+void
+selset_add(struct selset *ss, struct selhead *sh)
+{
+	struct selhead **h;
+	struct sel_pseudo *p;
+	struct sel *s;
+	uint32_t i, n;
+
+	if (ss->nheads == ss->headsz) {
+		n = ss->headsz ? ss->headsz * 2 : 64;
+		if ((h = reallocarray(ss->heads, n, sizeof(*h))) == NULL)
+			err(1, "reallocarray");
+		alloc_bytes += (n - ss->headsz) * sizeof(*h);
+		ss->heads = h;
+		ss->headsz = n;
+	}
+	ss->heads[ss->nheads++] = sh;
+	TAILQ_FOREACH(s, sh, next) {
+		switch (s->op) {
+		case EOP_NEVER:
+			/* the left side of the next one */
+			break;
+		case EOP_INSIDE:
+		case EOP_PARENT:
+		case EOP_NEXT:
+		case EOP_PRECED:
+			rule_add(ss, s, TAILQ_PREV(s, selhead, next));
+			break;
+		default:
+			if ((p = sel_bare_is(s)) == NULL) {
+				rule_add(ss, s, NULL);
+				break;
+			}
+			/* each of :is(a, b) is filed under its own key */
+			for (i = 0; i < p->nalts; i++)
+				rule_add(ss, p->alts[i].s, p->alts[i].left);
+			break;
+		}
+	}
+}
+
+static int
+try_rules(struct domhead *dh, struct selset *ss, struct dom_elem *e,
+    uint32_t first)
+{
+	struct rule *r;
+	uint32_t i;
+
+	for (i = first; i != 0; i = r->next) {
+		r = &ss->rules[i - 1];
+		ss->tests++;
+		if (match_rel(dh, e, r->s, r->left))
+			return(1);
+	}
+	return(0);
+}
+
+static int
+try_key(struct domhead *dh, struct selset *ss, struct dom_elem *e, int kind,
+    uint32_t h, const char *key, size_t len)
+{
+	struct rule_bucket *b;
+
+	b = bucket_find(ss, kind, h, key, len);
+	return(b->first != 0 && try_rules(dh, ss, e, b->first));
+}
+
+static int
+node_match(struct domhead *dh, struct selset *ss, struct dom_elem *e,
+    uint32_t id)
+{
+	struct attr_elem *a;
+	struct elem_info *x;
+	struct atom *at;
+	const char *v;
+	size_t len;
+	uint32_t i;
+
+	if (try_rules(dh, ss, e, ss->any))
+		return(1);
+	if (e->type != DOMF_ELEM || ss->nslots == 0)
+		return(0);
+	/* the atoms already carry the hash of the names and classes */
+	DOM_FOREACH_ATTR(a, dh, e) {
+		at = &dh->atoms[a->katom];
+		if (try_key(dh, ss, e, SKEY_ATTR, at->hash, at->str, at->len))
+			return(1);
+		if (a->katom == id && (v = attr_value(dh, a, &len)) != NULL &&
+		    try_key(dh, ss, e, SKEY_ID, atom_hash(v, len), v, len))
+			return(1);
+	}
+	x = DOM_INFO(dh, e);
+	for (i = 0; i < x->ncls; i++) {
+		at = &dh->atoms[dh->cls[x->cls + i]];
+		if (try_key(dh, ss, e, SKEY_CLASS, at->hash, at->str, at->len))
+			return(1);
+	}
+	return(try_key(dh, ss, e, SKEY_TAG,
+	    atom_hash(DOM_STR(dh, e->name), e->name.len),
+	    DOM_STR(dh, e->name), e->name.len));
+}
+
+/*
+ * set bit in the match of every node matched by any rule.  Text and
+ * comments follow their parent.
+ */
+int
+selset_match(struct domhead *dh, struct selset *ss, uint16_t bit)
+{
+	struct dom_elem *e;
+	uint32_t i, id;
+
+	for (i = 0; i < ss->nheads; i++)
+		sel_prepare(dh, ss->heads[i]);
+	id = find_atom(dh, "id");
+	match_clear(dh);
+	for (i = 1; i < dh->nelems; i++) {
+		e = DOM_NODE(dh, i);
+		if (e->type == DOMF_TEXT || e->type == DOMF_COMM) {
+			if (DOM_NODE(dh, e->parent)->match & bit)
+				e->match |= bit;
+		} else if (node_match(dh, ss, e, id))
+			e->match |= bit;
+		if (e->match != 0)
+			match_add(dh, i);
+	}
+	return(0);
+}
+
+void
+selset_free(struct selset *ss)
+{
+	free(ss->heads);
+	free(ss->rules);
+	free(ss->slots);
+	selset_init(ss);
+}
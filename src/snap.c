@@ -0,0 +1,421 @@
+/* $Id$ */
+/*
+ * Copyright (c) 2024 Michael Graves
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * the parsed dom kept in a file for the next run over the same input.
+ * The nodes, attributes and the atom tables only hold indices and source
+ * offsets, so they are written as they are and used in place from a
+ * private mapping of the file.  The atoms point at their strings and are
+ * the one table made again, from a pool of the strings.  The file holds
+ * a hash of the input and of the layout of the tables and is only used
+ * for the input and the build it was made from.  Every index in it is
+ * checked before the dom is used, a damaged file is parsed over.
+ */
+
+#include "config.h"
+
+#if HAVE_SYS_QUEUE
+#include <sys/queue.h>
+#endif
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#if HAVE_ERR
+#include <err.h>
+#endif
+#include <fcntl.h>
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "hq.h"
+
+#define SNAP_MAGIC		"hqsnap\0\0"
+#define SNAP_VERSION	3
+
+/* every node is read by the match, fault them in with the mapping */
+#ifndef MAP_POPULATE
+#define MAP_POPULATE	0
+#endif
+
+enum {
+	SNAP_ELEMS,
+	SNAP_ATTRS,
+	SNAP_INFO,
+	SNAP_ATOMS,
+	SNAP_SLOTS,
+	SNAP_CLS,
+	SNAP_AIDX,
+	SNAP_POOL,
+	SNAP_MAX
+};
+
+struct snap_atom {
+	uint32_t	off;		/* into the pool */
+	uint32_t	len;
+	uint32_t	hash;
+};
+
+struct snap_hdr {
+	char		magic[8];
+	uint32_t	version;
+	uint32_t	pad;
+	uint64_t	layout;		/* see snap_layout() */
+	uint64_t	hash;		/* of the input */
+	uint64_t	rawlen;
+	uint32_t	class_atom;
+	uint32_t	pad2;
+	struct {
+		uint64_t	off;
+		uint64_t	n;
+	} sec[SNAP_MAX];
+};
+
+static const size_t secsz[SNAP_MAX] = {
+	sizeof(struct dom_elem),
+	sizeof(struct attr_elem),
+	sizeof(struct elem_info),
+	sizeof(struct snap_atom),
+	sizeof(uint32_t),
+	sizeof(uint32_t),
+	sizeof(uint32_t),
+	1
+};
+
+#define FIELD(_t,_f)	offsetof(_t, _f), sizeof(((_t *)0)->_f)
+
+/* where each field of the tables is, a change to one changes the hash */
+static const size_t layout[] = {
+	sizeof(struct dom_elem),
+	FIELD(struct dom_elem, match),
+	FIELD(struct dom_elem, type),
+	FIELD(struct dom_elem, flags),
+	FIELD(struct dom_elem, line),
+	FIELD(struct dom_elem, parent),
+	FIELD(struct dom_elem, child),
+	FIELD(struct dom_elem, next),
+	FIELD(struct dom_elem, end),
+	FIELD(struct dom_elem, info),
+	FIELD(struct dom_elem, attr),
+	FIELD(struct dom_elem, nattr),
+	FIELD(struct dom_elem, name),
+	FIELD(struct dom_elem, value),
+	sizeof(struct attr_elem),
+	FIELD(struct attr_elem, key),
+	FIELD(struct attr_elem, value),
+	FIELD(struct attr_elem, katom),
+	sizeof(struct elem_info),
+	FIELD(struct elem_info, prev_el),
+	FIELD(struct elem_info, next_el),
+	FIELD(struct elem_info, pos),
+	FIELD(struct elem_info, cls),
+	FIELD(struct elem_info, ncls),
+	FIELD(struct elem_info, aidx),
+	FIELD(struct elem_info, tpos),
+	FIELD(struct elem_info, ntype),
+	FIELD(struct elem_info, nel),
+	FIELD(struct elem_info, etag),
+	sizeof(struct span),
+	FIELD(struct span, off),
+	FIELD(struct span, len),
+	sizeof(struct snap_atom),
+	sizeof(struct snap_hdr)
+};
+
+static uint64_t snap_layout(void);
+static void sec_write(FILE *, struct snap_hdr *, int, const void *, size_t);
+static int span_ok(struct domhead *, struct span);
+static int snap_check(struct domhead *);
+
+/* of the whole input, a word at a time */
+uint64_t
+snap_hash(const char *s, size_t len)
+{
+	uint64_t h = 0x9e3779b97f4a7c15ULL ^ len, w;
+
+	for (; len >= 8; s += 8, len -= 8) {
+		memcpy(&w, s, 8);
+		h = (h ^ w) * 0xff51afd7ed558ccdULL;
+		h ^= h >> 32;
+	}
+	for (w = 0; len > 0; len--)
+		w = (w << 8) | (unsigned char)s[len - 1];
+	h = (h ^ w) * 0xc4ceb9fe1a85ec53ULL;
+	h ^= h >> 29;
+	return(h);
+}
+
+static uint64_t
+snap_layout(void)
+{
+	return(snap_hash((const char *)layout, sizeof(layout)));
+}
+
+static void
+sec_write(FILE *f, struct snap_hdr *hd, int sec, const void *p, size_t n)
+{
+	static const char zero[8];
+	size_t pad;
+	long off;
+
+	/* every table starts on 8 bytes */
+	if ((off = ftell(f)) == -1)
+		err(1, "ftell");
+	pad = (8 - off % 8) % 8;
+	if (pad != 0 && fwrite(zero, 1, pad, f) != pad)
+		err(1, "fwrite");
+	hd->sec[sec].off = ftell(f);
+	hd->sec[sec].n = n;
+	if (n != 0 && fwrite(p, secsz[sec], n, f) != n)
+		err(1, "fwrite");
+}
+
+/*
+ * write dh to path, by way of a temporary file renamed over it so a run
+ * reading it at the same time sees the old one or the new one.  A
+ * failure only warns, the next run parses again.
+ */
+void
+snap_save(struct domhead *dh, const char *path, uint64_t hash)
+{
+	struct snap_hdr hd;
+	struct snap_atom *sa;
+	char *tmp, *pool, *p;
+	size_t npool = 0;
+	uint32_t i;
+	FILE *f;
+	int fd;
+
+	if (asprintf(&tmp, "%s.XXXXXXXXXX", path) == -1)
+		err(1, "asprintf");
+	if ((fd = mkstemp(tmp)) == -1) {
+		warn("%s", tmp);
+		free(tmp);
+		return;
+	}
+	if ((f = fdopen(fd, "w")) == NULL)
+		err(1, "fdopen");
+
+	for (i = 0; i < dh->natoms; i++)
+		npool += dh->atoms[i].len;
+	if ((sa = calloc(dh->natoms + 1, sizeof(*sa))) == NULL ||
+	    (pool = malloc(npool + 1)) == NULL)
+		err(1, "malloc");
+	for (p = pool, i = 0; i < dh->natoms; i++) {
+		sa[i].off = p - pool;
+		sa[i].len = dh->atoms[i].len;
+		sa[i].hash = dh->atoms[i].hash;
+		memcpy(p, dh->atoms[i].str, sa[i].len);
+		p += sa[i].len;
+	}
+
+	memset(&hd, 0, sizeof(hd));
+	memcpy(hd.magic, SNAP_MAGIC, sizeof(hd.magic));
+	hd.version = SNAP_VERSION;
+	hd.layout = snap_layout();
+	hd.hash = hash;
+	hd.rawlen = dh->rawlen;
+	hd.class_atom = dh->class_atom;
+	/* the header is written again once the tables are placed */
+	if (fwrite(&hd, sizeof(hd), 1, f) != 1)
+		err(1, "fwrite");
+	sec_write(f, &hd, SNAP_ELEMS, dh->elems, dh->nelems);
+	sec_write(f, &hd, SNAP_ATTRS, dh->attrs, dh->nattrs);
+	sec_write(f, &hd, SNAP_INFO, dh->info, dh->ninfo);
+	sec_write(f, &hd, SNAP_ATOMS, sa, dh->natoms);
+	sec_write(f, &hd, SNAP_SLOTS, dh->aslots, dh->nslots);
+	sec_write(f, &hd, SNAP_CLS, dh->cls, dh->ncls);
+	sec_write(f, &hd, SNAP_AIDX, dh->aidx, dh->naidx);
+	sec_write(f, &hd, SNAP_POOL, pool, npool);
+	if (fseek(f, 0, SEEK_SET) == -1 ||
+	    fwrite(&hd, sizeof(hd), 1, f) != 1)
+		err(1, "fwrite");
+	if (fclose(f) != 0) {
+		warn("%s", tmp);
+		unlink(tmp);
+	} else if (rename(tmp, path) == -1) {
+		warn("%s", path);
+		unlink(tmp);
+	}
+	free(sa);
+	free(pool);
+	free(tmp);
+}
+
+/*
+ * set up dh from the file at path if it was made from raw, the input
+ * with this hash.  0 if it was, -1 if the input has to be parsed.
+ */
+int
+snap_load(struct domhead *dh, const char *path, char *raw, size_t rawlen,
+    uint64_t hash)
+{
+	struct snap_hdr *hd;
+	struct snap_atom *sa;
+	struct stat st;
+	char *map, *pool;
+	uint64_t i, sz;
+	int fd;
+
+	if ((fd = open(path, O_RDONLY)) == -1)
+		return(-1);
+	if (fstat(fd, &st) == -1 || (size_t)st.st_size < sizeof(*hd)) {
+		close(fd);
+		return(-1);
+	}
+	/* private, matching writes to the nodes */
+	sz = st.st_size;
+	map = mmap(NULL, sz, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_POPULATE,
+	    fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+		return(-1);
+	hd = (struct snap_hdr *)map;
+	if (memcmp(hd->magic, SNAP_MAGIC, sizeof(hd->magic)) != 0 ||
+	    hd->version != SNAP_VERSION ||
+	    hd->layout != snap_layout() ||
+	    hd->hash != hash || hd->rawlen != rawlen ||
+	    hd->sec[SNAP_ELEMS].n == 0 || hd->sec[SNAP_INFO].n == 0)
+		goto bad;
+	for (i = 0; i < SNAP_MAX; i++) {
+		if (hd->sec[i].off % 8 != 0 || hd->sec[i].off > sz ||
+		    hd->sec[i].n > UINT32_MAX ||
+		    hd->sec[i].n * secsz[i] > sz - hd->sec[i].off)
+			goto bad;
+	}
+	sa = (struct snap_atom *)(map + hd->sec[SNAP_ATOMS].off);
+	pool = map + hd->sec[SNAP_POOL].off;
+	for (i = 0; i < hd->sec[SNAP_ATOMS].n; i++) {
+		if (sa[i].off > hd->sec[SNAP_POOL].n ||
+		    sa[i].len > hd->sec[SNAP_POOL].n - sa[i].off)
+			goto bad;
+	}
+
+	memset(dh, 0, sizeof(*dh));
+	dh->raw = raw;
+	dh->rawlen = rawlen;
+	dh->map = map;
+	dh->mapsz = sz;
+	dh->elems = (struct dom_elem *)(map + hd->sec[SNAP_ELEMS].off);
+	dh->nelems = dh->elemsz = hd->sec[SNAP_ELEMS].n;
+	dh->attrs = (struct attr_elem *)(map + hd->sec[SNAP_ATTRS].off);
+	dh->nattrs = dh->attrsz = hd->sec[SNAP_ATTRS].n;
+	dh->info = (struct elem_info *)(map + hd->sec[SNAP_INFO].off);
+	dh->ninfo = dh->infosz = hd->sec[SNAP_INFO].n;
+	dh->aslots = (uint32_t *)(map + hd->sec[SNAP_SLOTS].off);
+	dh->nslots = hd->sec[SNAP_SLOTS].n;
+	dh->cls = (uint32_t *)(map + hd->sec[SNAP_CLS].off);
+	dh->ncls = dh->clssz = hd->sec[SNAP_CLS].n;
+	dh->aidx = (uint32_t *)(map + hd->sec[SNAP_AIDX].off);
+	dh->naidx = dh->aidxsz = hd->sec[SNAP_AIDX].n;
+	dh->class_atom = hd->class_atom;
+	dh->natoms = dh->atomsz = hd->sec[SNAP_ATOMS].n;
+	if ((dh->atoms = calloc(dh->natoms + 1, sizeof(*dh->atoms))) == NULL)
+		err(1, "calloc");
+	alloc_bytes += dh->natoms * sizeof(*dh->atoms);
+	for (i = 0; i < dh->natoms; i++) {
+		dh->atoms[i].str = pool + sa[i].off;
+		dh->atoms[i].len = sa[i].len;
+		dh->atoms[i].hash = sa[i].hash;
+	}
+	if (snap_check(dh) == -1) {
+		free(dh->atoms);
+		memset(dh, 0, sizeof(*dh));
+		goto bad;
+	}
+	return(0);
+bad:
+	munmap(map, sz);
+	return(-1);
+}
+
+static int
+span_ok(struct domhead *dh, struct span s)
+{
+	return(s.off <= dh->rawlen && s.len <= dh->rawlen - s.off);
+}
+
+/* -1 if an index in the tables points outside of them */
+static int
+snap_check(struct domhead *dh)
+{
+	struct dom_elem *e;
+	struct elem_info *x;
+	struct attr_elem *a;
+	uint32_t i;
+
+	if ((dh->nslots & (dh->nslots - 1)) != 0 ||
+	    (dh->natoms != 0 && dh->nslots <= dh->natoms))
+		return(-1);
+	for (i = 0; i < dh->nslots; i++) {
+		if (dh->aslots[i] > dh->natoms)
+			return(-1);
+	}
+	if (dh->class_atom != ATOM_NONE && dh->class_atom >= dh->natoms)
+		return(-1);
+	for (i = 0; i < dh->ncls; i++) {
+		if (dh->cls[i] >= dh->natoms)
+			return(-1);
+	}
+	for (i = 0; i < dh->naidx; i++) {
+		if (dh->aidx[i] >= dh->nattrs)
+			return(-1);
+	}
+	for (i = 0; i < dh->nattrs; i++) {
+		a = &dh->attrs[i];
+		if (a->katom >= dh->natoms || !span_ok(dh, a->key) ||
+		    !span_ok(dh, a->value))
+			return(-1);
+	}
+	for (i = 0; i < dh->ninfo; i++) {
+		x = &dh->info[i];
+		if (x->cls > dh->ncls || x->ncls > dh->ncls - x->cls ||
+		    x->aidx > dh->naidx || x->etag >= dh->rawlen)
+			return(-1);
+	}
+	/* in preorder, so no walk along the links can go round */
+	for (i = 0; i < dh->nelems; i++) {
+		e = DOM_NODE(dh, i);
+		if ((i != 0 && e->parent >= i) || e->end < i ||
+		    e->end >= dh->nelems ||
+		    (e->child != 0 && e->child != i + 1) ||
+		    (e->next != 0 && e->next != e->end + 1) ||
+		    e->info >= dh->ninfo || e->attr > dh->nattrs ||
+		    e->nattr > dh->nattrs - e->attr ||
+		    !span_ok(dh, e->name) || !span_ok(dh, e->value))
+			return(-1);
+		x = DOM_INFO(dh, e);
+		if ((x->prev_el != 0 && x->prev_el >= i) ||
+		    (x->next_el != 0 && x->next_el <= i) ||
+		    x->next_el >= dh->nelems ||
+		    (e->nattr > ATTR_WIDE && e->nattr > dh->naidx - x->aidx))
+			return(-1);
+	}
+	return(0);
+}
+
+/* the tables of a loaded dom, the rest is left to free_dom() */
+void
+snap_free(struct domhead *dh)
+{
+	free(dh->atoms);
+	munmap(dh->map, dh->mapsz);
+}
@@ -0,0 +1,162 @@
+/* $Id$ */
+/*
+ * Copyright (c) 2024 Michael Graves
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "config.h"
+
+#if HAVE_SYS_QUEUE
+#include <sys/queue.h>
+#endif
+#include <sys/resource.h>
+#include <sys/time.h>
+
+#if HAVE_ERR
+#include <err.h>
+#endif
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "hq.h"
+
+size_t alloc_bytes;		/* counted by the alloc_* helpers */
+
+const char *phase_str[] = {
+	"read",
+	"parse_sel",
+	"parse_dom",
+	"modify_dom",
+	"print_dom"
+};
+
+static struct {
+	double	wall;
+	double	cpu;
+	double	wall_st;
+	double	cpu_st;
+} phases[PHASE_MAX];
+
+static struct {
+	size_t	input;
+	size_t	nodes;
+	size_t	elems;
+	size_t	texts;
+	size_t	comments;
+	size_t	attrs;
+} counts;
+
+static double clock_sec(clockid_t);
+static long peak_rss_kb(void);
+
+static double
+clock_sec(clockid_t id)
+{
+	struct timespec ts;
+
+	if (clock_gettime(id, &ts) == -1)
+		return(0);
+	return(ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+void
+stats_start(int p)
+{
+	phases[p].wall_st = clock_sec(CLOCK_MONOTONIC);
+	phases[p].cpu_st = clock_sec(CLOCK_PROCESS_CPUTIME_ID);
+	if (perf_enabled)
+		perf_start(p);
+}
+
+void
+stats_stop(int p)
+{
+	if (perf_enabled)
+		perf_stop(p);
+	phases[p].wall += clock_sec(CLOCK_MONOTONIC) - phases[p].wall_st;
+	phases[p].cpu += clock_sec(CLOCK_PROCESS_CPUTIME_ID) - phases[p].cpu_st;
+}
+
+void
+stats_count(struct domhead *dh, size_t input)
+{
+	uint32_t i;
+
+	counts.input = input;
+	counts.attrs = dh->nattrs;
+	for (i = 1; i < dh->nelems; i++) {
+		counts.nodes++;
+		switch (DOM_NODE(dh, i)->type) {
+			case DOMF_ELEM:
+				counts.elems++;
+				break;
+			case DOMF_TEXT:
+				counts.texts++;
+				break;
+			case DOMF_COMM:
+				counts.comments++;
+				break;
+			default:
+				break;
+		}
+	}
+}
+
+/* ru_maxrss is in kilobytes everywhere but macOS */
+static long
+peak_rss_kb(void)
+{
+	struct rusage ru;
+
+	if (getrusage(RUSAGE_SELF, &ru) == -1)
+		return(0);
+#if defined(__APPLE__)
+	return(ru.ru_maxrss / 1024);
+#else
+	return(ru.ru_maxrss);
+#endif
+}
+
+void
+stats_print(FILE *f, int json)
+{
+	int i;
+
+	if (json) {
+		fprintf(f, "{\"phases\":{");
+		for (i = 0; i < PHASE_MAX; i++)
+			fprintf(f, "%s\"%s\":{\"wall_ms\":%.3f,\"cpu_ms\":%.3f}",
+			    i ? "," : "", phase_str[i], phases[i].wall * 1e3,
+			    phases[i].cpu * 1e3);
+		fprintf(f, "},\"input_bytes\":%zu,\"nodes\":%zu,\"elements\":%zu,"
+		    "\"text\":%zu,\"comments\":%zu,\"attributes\":%zu,"
+		    "\"alloc_bytes\":%zu,\"peak_rss_kb\":%ld}\n", counts.input,
+		    counts.nodes, counts.elems, counts.texts, counts.comments,
+		    counts.attrs, alloc_bytes, peak_rss_kb());
+		return;
+	}
+	fprintf(f, "%-12s %10s %10s\n", "phase", "wall ms", "cpu ms");
+	for (i = 0; i < PHASE_MAX; i++)
+		fprintf(f, "%-12s %10.3f %10.3f\n", phase_str[i],
+		    phases[i].wall * 1e3, phases[i].cpu * 1e3);
+	fprintf(f, "input:       %zu bytes\n", counts.input);
+	fprintf(f, "nodes:       %zu (%zu elements, %zu text, %zu comments)\n",
+	    counts.nodes, counts.elems, counts.texts, counts.comments);
+	fprintf(f, "attributes:  %zu\n", counts.attrs);
+	fprintf(f, "allocated:   %zu bytes\n", alloc_bytes);
+	fprintf(f, "peak rss:    %ld KB\n", peak_rss_kb());
+}
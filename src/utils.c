@@ -50,36 +50,176 @@ init_buf(char *buf, size_t sz)
 	raw_off = 0;
 }
 
-struct dom_elem *
-alloc_elem(void)
+/* grow the node array by doubling, returns the index of the new node */
+uint32_t
+alloc_elem(struct domhead *dh)
 {
 	struct dom_elem *e;
+	uint32_t n;
 
-	if ((e = calloc(1,sizeof(struct dom_elem))) == NULL)
-		err(1, "calloc");
-	TAILQ_INIT(&e->attrs);
-	TAILQ_INIT(&e->children);
-	return(e);
+	if (dh->nelems == dh->elemsz) {
+		n = dh->elemsz ? dh->elemsz * 2 : 64;
+		if ((e = reallocarray(dh->elems, n, sizeof(*e))) == NULL)
+			err(1, "reallocarray");
+		alloc_bytes += (n - dh->elemsz) * sizeof(*e);
+		dh->elems = e;
+		dh->elemsz = n;
+	}
+	memset(&dh->elems[dh->nelems], 0, sizeof(*e));
+	return(dh->nelems++);
 }
 
-struct attr_elem *
-alloc_attr(void)
+uint32_t
+alloc_attr(struct domhead *dh)
 {
 	struct attr_elem *a;
+	uint32_t n;
 
-	if ((a = calloc(1,sizeof(struct attr_elem))) == NULL)
-		err(1, "calloc");
-	return(a);
+	if (dh->nattrs == dh->attrsz) {
+		n = dh->attrsz ? dh->attrsz * 2 : 64;
+		if ((a = reallocarray(dh->attrs, n, sizeof(*a))) == NULL)
+			err(1, "reallocarray");
+		alloc_bytes += (n - dh->attrsz) * sizeof(*a);
+		dh->attrs = a;
+		dh->attrsz = n;
+	}
+	memset(&dh->attrs[dh->nattrs], 0, sizeof(*a));
+	return(dh->nattrs++);
+}
+
+/* entry 0 is kept empty for the nodes that are not elements */
+uint32_t
+alloc_info(struct domhead *dh)
+{
+	struct elem_info *x;
+	uint32_t n;
+
+	if (dh->ninfo + 1 >= dh->infosz) {
+		n = dh->infosz ? dh->infosz * 2 : 64;
+		if ((x = reallocarray(dh->info, n, sizeof(*x))) == NULL)
+			err(1, "reallocarray");
+		alloc_bytes += (n - dh->infosz) * sizeof(*x);
+		dh->info = x;
+		dh->infosz = n;
+	}
+	if (dh->ninfo == 0)
+		memset(&dh->info[dh->ninfo++], 0, sizeof(*x));
+	memset(&dh->info[dh->ninfo], 0, sizeof(*x));
+	return(dh->ninfo++);
 }
 
+/* the source buffer belongs to the caller and is left alone */
+void
+free_dom(struct domhead *dh)
+{
+	free_values(dh);
+	free(dh->mlist);
+	if (dh->map != NULL)
+		snap_free(dh);
+	else {
+		free_atoms(dh);
+		free(dh->elems);
+		free(dh->attrs);
+		free(dh->info);
+	}
+	memset(dh, 0, sizeof(*dh));
+}
+
+/*
+ * the bytes of the node in the source: the tag, or all of a text, comment
+ * or doctype, and the end tag of an element that has one.  The spans the
+ * parser keeps are of the names and values so the brackets are found
+ * around them.
+ */
+void
+node_span(struct domhead *dh, struct dom_elem *e, struct span *tag,
+    struct span *etag)
+{
+	struct attr_elem *a;
+	uint32_t st, end;
+
+	etag->off = etag->len = 0;
+	if (e->type == DOMF_TEXT) {
+		*tag = e->value;
+		return;
+	}
+	st = (e->type == DOMF_ELEM) ? e->name.off : e->value.off;
+	end = st + (e->type == DOMF_ELEM ? e->name.len : e->value.len);
+	/* past the last attribute, a quoted value may hold a > */
+	if (e->type == DOMF_ELEM && e->nattr != 0) {
+		a = DOM_ATTR(dh, e, e->nattr - 1);
+		if (a->value.off != 0 && a->value.off + a->value.len > end)
+			end = a->value.off + a->value.len;
+		else if (a->key.off + a->key.len > end)
+			end = a->key.off + a->key.len;
+	}
+	while (st > 0 && dh->raw[st] != '<')
+		st--;
+	while (end < dh->rawlen && dh->raw[end] != '>')
+		end++;
+	tag->off = st;
+	tag->len = (end < dh->rawlen ? end + 1 : end) - st;
+	if (e->type != DOMF_ELEM || (end = DOM_INFO(dh, e)->etag) == 0)
+		return;
+	for (st = end; st > 0 && dh->raw[st] != '<'; st--)
+		;
+	for (; end < dh->rawlen && dh->raw[end] != '>'; end++)
+		;
+	etag->off = st;
+	etag->len = (end < dh->rawlen ? end + 1 : end) - st;
+}
+
+/* the end of the subtree of e in the source */
+uint32_t
+node_end(struct domhead *dh, struct dom_elem *e)
+{
+	struct dom_elem *x;
+	struct span tag, etag;
+	uint32_t end;
+
+	x = DOM_NODE(dh, e->end);
+	for (end = 0; ; x = DOM_NODE(dh, x->parent)) {
+		node_span(dh, x, &tag, &etag);
+		if (etag.len != 0 && etag.off + etag.len > end)
+			end = etag.off + etag.len;
+		else if (tag.off + tag.len > end)
+			end = tag.off + tag.len;
+		if (x == e)
+			break;
+	}
+	return(end);
+}
+
+/* top level nodes are the children of the root */
 int
 is_top(struct dom_elem *e)
 {
-	if (e == e->parent)
+	if (e->parent == DOM_ROOT)
 		return(1);
 	return(0);
 }
 
+int
+span_strcasecmp(struct domhead *dh, struct span s, const char *str)
+{
+	int rc;
+
+	if ((rc = strncasecmp(DOM_STR(dh, s), str, s.len)) != 0)
+		return(rc);
+	return(str[s.len] == '\0' ? 0 : -1);
+}
+
+int
+span_casecmp(struct domhead *dh, struct span a, struct span b)
+{
+	int rc;
+
+	if ((rc = strncasecmp(DOM_STR(dh, a), DOM_STR(dh, b),
+	    a.len < b.len ? a.len : b.len)) != 0)
+		return(rc);
+	return((a.len > b.len) - (a.len < b.len));
+}
+
 char *
 extract_str(char *start, char *end)
 {
@@ -90,6 +230,7 @@ extract_str(char *start, char *end)
 		return(NULL);
 	if ((str = calloc(1,end-start+1)) == NULL)
 		return(NULL);
+	alloc_bytes += end-start+1;
 	memcpy(str,start,(end-start));
 	return(str);
 }
@@ -116,7 +257,7 @@ lgetc(int notused)
 	if (raw_off >= raw_size) {
 		return(EOF);
 	}
-	c = raw_data[raw_off];
+	c = (unsigned char)raw_data[raw_off];
 	raw_off++;
 	return(c);
 }
@@ -135,7 +276,7 @@ peek_back(void)
 {
 	if (raw_off == 0)
 		return(0);
-	return(raw_data[raw_off-2]);
+	return((unsigned char)raw_data[raw_off-2]);
 }
 
 struct sel_attr *
@@ -145,9 +286,38 @@ alloc_sel_attr(void)
 
 	if ((a = calloc(1,sizeof(struct sel_attr))) == NULL)
 		err(1, "calloc");
+	alloc_bytes += sizeof(struct sel_attr);
 	return(a);
 }
 
+struct sel_pseudo *
+alloc_sel_pseudo(void)
+{
+	struct sel_pseudo *p;
+
+	if ((p = calloc(1,sizeof(struct sel_pseudo))) == NULL)
+		err(1, "calloc");
+	alloc_bytes += sizeof(struct sel_pseudo);
+	return(p);
+}
+
+void
+free_sel_pseudo(struct sel_pseudo *p)
+{
+	free(p->name);
+	free(p->arg);
+	if (p->sub != NULL) {
+		free_sel(p->sub);
+		free(p->sub);
+	}
+	free(p->memo);
+	free(p->alts);
+	free(p->needle);
+	free(p->hits);
+	rx_free(p->re);
+	free(p);
+}
+
 struct sel *
 alloc_sel(void)
 {
@@ -155,10 +325,52 @@ alloc_sel(void)
 
 	if ((e = calloc(1,sizeof(struct sel))) == NULL)
 		err(1, "calloc");
+	alloc_bytes += sizeof(struct sel);
 	TAILQ_INIT(&e->attrs);
+	TAILQ_INIT(&e->pseudos);
 	return(e);
 }
 
+void
+free_sel(struct selhead *sh)
+{
+	struct sel *s;
+	struct sel_attr *a;
+	struct sel_pseudo *p;
+
+	while ((s = TAILQ_FIRST(sh)) != NULL) {
+		TAILQ_REMOVE(sh, s, next);
+		while ((a = TAILQ_FIRST(&s->attrs)) != NULL) {
+			TAILQ_REMOVE(&s->attrs, a, next);
+			free(a->name);
+			free(a->val);
+			free(a->needle);
+			rx_free(a->re);
+			free(a);
+		}
+		while ((p = TAILQ_FIRST(&s->pseudos)) != NULL) {
+			TAILQ_REMOVE(&s->pseudos, p, next);
+			free_sel_pseudo(p);
+		}
+		free(s->elem);
+		free(s->sibs);
+		free(s);
+	}
+}
+
+/* clear the per pass match state before a new walk of the dom */
+void
+reset_sel(struct selhead *sh)
+{
+	struct sel *s;
+
+	TAILQ_FOREACH(s, sh, next) {
+		s->scope = 0;
+		if (s->sibs != NULL)
+			memset(s->sibs, 0, s->nsibs * sizeof(uint32_t));
+	}
+}
+
 struct sel_attr *
 find_attr(struct sel *s, char *name)
 {
@@ -170,47 +382,69 @@ find_attr(struct sel *s, char *name)
 	return(NULL);
 }
 
+/* HTML void elements, sorted for bsearch(3) */
+static const char *void_elems[] = {
+	"area",
+	"base",
+	"br",
+	"col",
+	"embed",
+	"hr",
+	"img",
+	"input",
+	"link",
+	"meta",
+	"source",
+	"track",
+	"wbr"
+};
+
+static int
+void_cmp(const void *k, const void *e)
+{
+	return(strcasecmp((const char *)k, *(const char * const *)e));
+}
+
+/*
+ * return 1 if name is a void element (no closing tag).  Only called
+ * once per element while parsing, the result is kept in ELEM_NOEND.
+ */
 int
-unterminated_element(char *name)
-{
-	if (
-//		((strcasecmp("li", name)) == 0) ||
-		((strcasecmp("br", name)) == 0) ||
-		((strcasecmp("hr", name)) == 0) ||
-		((strcasecmp("img", name)) == 0) ||
-		((strcasecmp("link", name)) == 0) ||
-		((strcasecmp("meta", name)) == 0)
-		) {
+void_element(const char *name, size_t len)
+{
+	char buf[8];
+
+	if (len < 2 || len > 6)
+		return(0);
+	memcpy(buf, name, len);
+	buf[len] = '\0';
+	if (bsearch(buf, void_elems, sizeof(void_elems)/sizeof(void_elems[0]),
+	    sizeof(void_elems[0]), void_cmp) != NULL)
 		return(1);
-	}
 	return(0);
 }
 
+/* element siblings, NULL at either end */
 struct dom_elem *
-prev_elem(struct dom_elem *e)
+prev_elem(struct domhead *dh, struct dom_elem *e)
 {
-	struct dom_elem *p;
-	if (e == NULL)
-		return(NULL);
-
-	if (e == TAILQ_FIRST(e->head))
+	if (e == NULL || DOM_INFO(dh, e)->prev_el == 0)
 		return(NULL);
-	p = TAILQ_PREV(e, domhead, next);
-	return(p);
+	return(DOM_NODE(dh, DOM_INFO(dh, e)->prev_el));
 }
 
 struct dom_elem *
-next_elem(struct dom_elem *e)
+next_elem(struct domhead *dh, struct dom_elem *e)
 {
-	struct dom_elem *p;
-	if (e == NULL)
-		return(NULL);
-	if (e == TAILQ_LAST(e->head,domhead))
+	if (e == NULL || DOM_INFO(dh, e)->next_el == 0)
 		return(NULL);
-	p = TAILQ_NEXT(e, next);
-	return(p);
+	return(DOM_NODE(dh, DOM_INFO(dh, e)->next_el));
 }
 
+#define IS_SPACE(_c) \
+		((_c) == ' ' || (_c) == '\t' || (_c) == '\n' || (_c) == '\r' || \
+		 (_c) == '\f' || (_c) == '\v')
+
 /* 
  * update string in place.
  * remove any leading or trailing space, tabs, newlines
@@ -223,18 +457,18 @@ clean_str(char *str)
 	char *h, *p, *t;
 	h = p = str;
 	/* skip leading spaces and newlines*/
-	while (isspace(*p)) {
+	while (IS_SPACE(*p)) {
 		p++;
 	}
 	while (*p != '\0') {
-		while (isspace(*p) && *p != '\0') {
+		while (IS_SPACE(*p) && *p != '\0') {
 			p++;
 		}
 		if (*p == '\0') {
 			*h='\0';
 		} else {
 			t = p-1;
-			if (*t == ' ' || *t == '\t' || *t == '\n') {
+			if (p > str && (*t == ' ' || *t == '\t' || *t == '\n')) {
 				*h = ' '; 
 				h++;
 			}